@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""生成用来测编译速度的 SysY 程序.
+
+每种形状 (shape) 放大编译器的一个方面, size 控制规模:
+  nested  嵌套 size 层的代码块, 每层声明一个变量
+  expr    一个有 size 项的长表达式
+  decls   一个函数里连续 size 条声明和赋值
+  funcs   size 个小函数
+  mixed   size 个函数, 每个函数里混合了上面所有的结构
+  comments  和 mixed 相同, 另外穿插行注释, 块注释和八进制/十六进制常量, 主要用来测 lexer
+
+同样的 shape, size 和 seed 总是生成同样的程序, 这样不同版本的结果可以直接比较.
+
+用法: gen_sysy.py shape size [-s seed] [-o output]
+"""
+
+import argparse
+import random
+import sys
+
+SHAPES = ('nested', 'expr', 'decls', 'funcs', 'mixed', 'comments')
+
+# 缩进最多到这么多层, 否则 nested 的文件大小会随深度平方增长
+MAX_INDENT = 8
+
+
+class Gen:
+    def __init__(self, seed, comments=False):
+        self.rand = random.Random(seed)
+        self.lines = []
+        self.depth = 0
+        # 为 True 时在行尾和行之间随机加上注释
+        self.comments = comments
+
+    def emit(self, line):
+        indent = '  ' * min(self.depth, MAX_INDENT)
+        if self.comments:
+            r = self.rand.random()
+            if r < 0.1:
+                self.lines.append(indent + '// line comment before: ' + line)
+            elif r < 0.15:
+                self.lines.append(indent + '/* block comment')
+                self.lines.append(indent + ' * spanning ** several lines */')
+            elif r < 0.25:
+                line += '  // trailing comment'
+            elif r < 0.3:
+                line += ' /* trailing * block */'
+        self.lines.append(indent + line)
+
+    def text(self):
+        return '\n'.join(self.lines) + '\n'
+
+    # 一个叶子: 变量或者常量
+    def leaf(self, names):
+        if names and self.rand.random() < 0.7:
+            return self.rand.choice(names)
+        val = self.rand.randint(0, 1000)
+        if self.comments:
+            return self.rand.choice(['%d', '0%o', '0x%x', '0X%X']) % val
+        return str(val)
+
+    # 有 terms 项的表达式, 用的变量都在 names 中
+    # 除数和模数都是非零常量, 生成的程序运行时不会出错
+    def expr(self, names, terms):
+        parts = [self.leaf(names)]
+        for _ in range(terms - 1):
+            r = self.rand.random()
+            if r < 0.3:
+                parts.append('+ ' + self.leaf(names))
+            elif r < 0.5:
+                parts.append('- ' + self.leaf(names))
+            elif r < 0.7:
+                parts.append('* ' + self.leaf(names))
+            elif r < 0.8:
+                parts.append('/ ' + str(self.rand.randint(1, 64)))
+            elif r < 0.85:
+                parts.append('% ' + str(self.rand.randint(1, 64)))
+            elif r < 0.95:
+                op = self.rand.choice(['<', '>', '<=', '>=', '==', '!='])
+                parts.append('%s (%s)' % (op, self.leaf(names)))
+            else:
+                op = self.rand.choice(['&&', '||'])
+                parts.append('%s !%s' % (op, self.leaf(names)))
+        return ' '.join(parts)
+
+    def begin_func(self, name):
+        self.emit('int %s() {' % name)
+        self.depth += 1
+
+    def end_func(self, ret):
+        self.emit('return %s;' % ret)
+        self.depth -= 1
+        self.emit('}')
+
+    def nested(self, size):
+        self.begin_func('main')
+        self.emit('int v0 = 1;')
+        for i in range(1, size + 1):
+            self.emit('{')
+            self.depth += 1
+            self.emit('int v%d = v%d + %d;' % (i, i - 1, i))
+        self.emit('v0 = v%d;' % size)
+        for _ in range(size):
+            self.depth -= 1
+            self.emit('}')
+        self.end_func('v0')
+
+    def long_expr(self, size):
+        self.begin_func('main')
+        names = ['a', 'b', 'c', 'd']
+        for i, n in enumerate(names):
+            self.emit('int %s = %d;' % (n, i + 1))
+        self.emit('return %s;' % self.expr(names, size))
+        self.depth -= 1
+        self.emit('}')
+
+    def decls(self, size):
+        self.begin_func('main')
+        self.emit('int v0 = 1;')
+        for i in range(1, size + 1):
+            r = self.rand.random()
+            prev = ['v%d' % self.rand.randint(max(0, i - 16), i - 1) for _ in range(2)]
+            if r < 0.2:
+                self.emit('const int v%d = %d;' % (i, self.rand.randint(0, 100)))
+            elif r < 0.6:
+                self.emit('int v%d = %s;' % (i, self.expr(prev, 3)))
+            else:
+                self.emit('int v%d;' % i)
+                self.emit('v%d = %s;' % (i, self.expr(prev, 3)))
+        self.end_func('v%d' % size)
+
+    def funcs(self, size):
+        for i in range(size):
+            self.begin_func('f%d' % i)
+            self.emit('int x = %d;' % i)
+            self.emit('int y = x * %d + 1;' % self.rand.randint(1, 9))
+            self.end_func('x + y')
+        self.begin_func('main')
+        self.end_func('0')
+
+    # 一个中等大小的函数体: 声明, 赋值, 嵌套代码块和逻辑运算
+    def mixed_body(self, names, depth):
+        for _ in range(self.rand.randint(2, 5)):
+            name = 'v%d' % len(names)
+            if self.rand.random() < 0.3:
+                self.emit('const int %s = %d;' % (name, self.rand.randint(0, 100)))
+            else:
+                self.emit('int %s = %s;' % (name, self.expr(names, self.rand.randint(1, 8))))
+                names.append(name)
+        for _ in range(self.rand.randint(2, 6)):
+            if names and self.rand.random() < 0.6:
+                target = self.rand.choice(names)
+                self.emit('%s = %s;' % (target, self.expr(names, self.rand.randint(2, 12))))
+            elif depth < 4:
+                self.emit('{')
+                self.depth += 1
+                self.mixed_body(list(names), depth + 1)
+                self.depth -= 1
+                self.emit('}')
+            else:
+                self.emit('%s;' % self.expr(names, 3))
+
+    def mixed(self, size):
+        for i in range(size):
+            self.begin_func('f%d' % i if i + 1 < size else 'main')
+            names = ['p']
+            self.emit('int p = %d;' % i)
+            self.mixed_body(names, 0)
+            self.end_func(self.expr(names, 4))
+
+
+def generate(shape, size, seed=1):
+    g = Gen(seed, shape == 'comments')
+    if shape == 'nested':
+        g.nested(size)
+    elif shape == 'expr':
+        g.long_expr(size)
+    elif shape == 'decls':
+        g.decls(size)
+    elif shape == 'funcs':
+        g.funcs(size)
+    elif shape in ('mixed', 'comments'):
+        g.mixed(size)
+    else:
+        raise ValueError('unknown shape: ' + shape)
+    return g.text()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='generate SysY programs for compile-time benchmarks')
+    parser.add_argument('shape', choices=SHAPES)
+    parser.add_argument('size', type=int)
+    parser.add_argument('-s', '--seed', type=int, default=1)
+    parser.add_argument('-o', '--output', help='output file (default: stdout)')
+    args = parser.parse_args()
+    text = generate(args.shape, args.size, args.seed)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
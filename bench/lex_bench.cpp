@@ -0,0 +1,152 @@
+// lexer 的微基准测试
+// 分别用 flex 生成的 lexer 和手写的 FastLexer 反复扫描输入文件, 检查两者输出的 token 序列
+// (种类, 值和行号) 完全相同, 再报告各自的吞吐量
+// 用法: lex_bench [-r 重复次数] 文件...
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <vector>
+#include "context.h"
+#include "fast_lexer.h"
+
+// flex 生成的可重入 lexer 的接口
+extern int yylex_init(yyscan_t *scanner);
+extern void yyset_in(FILE *in, yyscan_t scanner);
+extern int yylex(YYSTYPE *lval, yyscan_t scanner);
+extern int yyget_lineno(yyscan_t scanner);
+extern int yylex_destroy(yyscan_t scanner);
+
+// 比较用的 token: IDENT 的值是驻留表中的编号, 两个 lexer 按同样的顺序驻留, 所以编号也相同
+struct TokenRecord {
+  int kind;
+  int val;
+  int line;
+
+  bool operator==(const TokenRecord &other) const {
+    return kind == other.kind && val == other.val && line == other.line;
+  }
+};
+
+static int token_val(int kind, const YYSTYPE &lval) {
+  if(kind == IDENT) {
+    return lval.sym_val;
+  } else if(kind == INT_CONST) {
+    return lval.int_val;
+  }
+  return 0;
+}
+
+static double now_ms() {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 用 flex 的 lexer 扫描一遍 path, 返回耗时 (毫秒), 打开文件失败时返回 -1
+static double run_flex(const char *path, std::vector<TokenRecord> &tokens) {
+  CompileContext ctx;
+  enter_context(&ctx);
+  tokens.clear();
+  double start = now_ms();
+  FILE *in = fopen(path, "r");
+  if(in == NULL) {
+    enter_context(NULL);
+    return -1;
+  }
+  yyscan_t scanner;
+  yylex_init(&scanner);
+  yyset_in(in, scanner);
+  YYSTYPE lval{};
+  int kind;
+  while((kind = yylex(&lval, scanner)) != 0) {
+    tokens.push_back(TokenRecord{kind, token_val(kind, lval), yyget_lineno(scanner)});
+  }
+  yylex_destroy(scanner);
+  fclose(in);
+  double time = now_ms() - start;
+  enter_context(NULL);
+  return time;
+}
+
+// 用 FastLexer 扫描一遍 path
+static double run_fast(const char *path, std::vector<TokenRecord> &tokens) {
+  CompileContext ctx;
+  enter_context(&ctx);
+  tokens.clear();
+  double start = now_ms();
+  FastLexer lexer;
+  if(!lexer.open(path)) {
+    enter_context(NULL);
+    return -1;
+  }
+  YYSTYPE lval{};
+  int kind;
+  while((kind = lexer.next(&lval)) != 0) {
+    tokens.push_back(TokenRecord{kind, token_val(kind, lval), lexer.lineno()});
+  }
+  double time = now_ms() - start;
+  enter_context(NULL);
+  return time;
+}
+
+int main(int argc, const char *argv[]) {
+  int repeat = 10;
+  std::vector<const char *> files;
+  for(int i = 1; i < argc; i ++) {
+    if(strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      repeat = std::max(1, atoi(argv[++ i]));
+    } else {
+      files.push_back(argv[i]);
+    }
+  }
+  if(files.empty()) {
+    fprintf(stderr, "usage: %s [-r repeat] file...\n", argv[0]);
+    return 2;
+  }
+
+  bool ok = true;
+  printf("%-32s %12s %10s %10s %10s %10s %10s %8s\n",
+         "file", "bytes", "tokens", "flex ms", "flex GB/s", "fast ms", "fast GB/s", "speedup");
+  for(const char *path : files) {
+    struct stat st;
+    if(stat(path, &st) != 0) {
+      perror(path);
+      ok = false;
+      continue;
+    }
+    // 每个 lexer 重复 repeat 次, 取最快的一次
+    std::vector<TokenRecord> flex_tokens, fast_tokens;
+    double flex_ms = 0, fast_ms = 0;
+    for(int r = 0; r < repeat; r ++) {
+      double t = run_flex(path, flex_tokens);
+      flex_ms = r == 0 ? t : std::min(flex_ms, t);
+      t = run_fast(path, fast_tokens);
+      fast_ms = r == 0 ? t : std::min(fast_ms, t);
+    }
+    if(flex_ms < 0 || fast_ms < 0) {
+      perror(path);
+      ok = false;
+      continue;
+    }
+
+    // 找出第一个不同的 token
+    size_t n = std::min(flex_tokens.size(), fast_tokens.size());
+    size_t diff = std::mismatch(flex_tokens.begin(), flex_tokens.begin() + n, fast_tokens.begin()).first - flex_tokens.begin();
+    if(diff < n || flex_tokens.size() != fast_tokens.size()) {
+      ok = false;
+      fprintf(stderr, "%s: token streams differ at token %zu (flex %zu tokens, fast %zu tokens)\n",
+              path, diff, flex_tokens.size(), fast_tokens.size());
+      if(diff < n) {
+        fprintf(stderr, "  flex: kind %d val %d line %d\n", flex_tokens[diff].kind, flex_tokens[diff].val, flex_tokens[diff].line);
+        fprintf(stderr, "  fast: kind %d val %d line %d\n", fast_tokens[diff].kind, fast_tokens[diff].val, fast_tokens[diff].line);
+      }
+    }
+
+    double bytes = st.st_size;
+    printf("%-32s %12lld %10zu %10.3f %10.3f %10.3f %10.3f %7.2fx\n",
+           path, (long long)st.st_size, fast_tokens.size(),
+           flex_ms, bytes / flex_ms / 1e6, fast_ms, bytes / fast_ms / 1e6, flex_ms / fast_ms);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,74 @@
+// 运行一条命令, 输出它的退出状态, 墙上时间 (毫秒) 和峰值内存 (KB)
+// 用法: measure timeout_sec cmd [args...]
+// 输出一行: ok|exit:N|signal:N|timeout wall_ms max_rss_kb
+//
+// 为什么不直接在 Python 里 wait4?
+// 因为 Linux 在 exec 时会保留旧进程的峰值 RSS, 从 Python fork 出来的进程
+// 测出来的峰值内存至少是 Python 解释器本身的大小, 小程序的结果就没有意义了
+// 这里先由一个很小的进程 fork, 子进程 exec 之前的 RSS 可以忽略不计
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static pid_t child;
+static int timed_out;
+
+static void on_alarm(int sig) {
+  (void)sig;
+  timed_out = 1;
+  kill(child, SIGKILL);
+}
+
+int main(int argc, char *argv[]) {
+  if(argc < 3) {
+    fprintf(stderr, "usage: %s timeout_sec cmd [args...]\n", argv[0]);
+    return 2;
+  }
+  int timeout = atoi(argv[1]);
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  child = fork();
+  if(child < 0) {
+    perror("fork");
+    return 2;
+  }
+  if(child == 0) {
+    // 编译器的输出不需要
+    int null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    dup2(null, STDERR_FILENO);
+    execvp(argv[2], argv + 2);
+    _exit(127);
+  }
+
+  signal(SIGALRM, on_alarm);
+  if(timeout > 0) {
+    alarm(timeout);
+  }
+  int status;
+  struct rusage usage;
+  while(wait4(child, &status, 0, &usage) < 0) {
+    // 被 SIGALRM 打断时继续等
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double wall_ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+
+  if(timed_out) {
+    printf("timeout");
+  } else if(WIFSIGNALED(status)) {
+    printf("signal:%d", WTERMSIG(status));
+  } else if(WEXITSTATUS(status) != 0) {
+    printf("exit:%d", WEXITSTATUS(status));
+  } else {
+    printf("ok");
+  }
+  printf(" %.3f %ld\n", wall_ms, usage.ru_maxrss);
+  return 0;
+}
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""编译速度的基准测试.
+
+对 gen_sysy.py 生成的每个程序分别运行 compiler -koopa 和 compiler -riscv,
+记录墙上时间 (多次运行取中位数), 峰值内存 (RSS) 和输出文件大小, 写成 CSV.
+编译器由 measure.c 编译出的小程序启动和计时, 见其中的说明.
+CSV 的行顺序和内容只取决于参数, 可以直接 diff 两个版本的结果;
+指定 --baseline 时还会输出和之前结果的比值, 方便发现规模上的退化.
+
+编译器失败 (崩溃, 栈溢出, 超时) 时 status 列记录原因, 不会中断整个测试.
+
+用法: run_bench.py [-c build/compiler] [-m build/bench/measure] [-o build/bench/results.csv] [--baseline old.csv]
+"""
+
+import argparse
+import csv
+import os
+import signal
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import gen_sysy
+
+# 每种形状测试的规模, 相邻两档相差 10 倍左右, 用来看耗时是不是线性增长
+DEFAULT_SIZES = {
+    'nested': [100, 1000, 5000],
+    'expr': [1000, 10000, 100000],
+    'decls': [1000, 10000, 50000],
+    'funcs': [100, 1000, 10000],
+    'mixed': [10, 100, 1000],
+    'comments': [10, 100, 1000],
+}
+
+MODES = ('koopa', 'riscv')
+
+FIELDS = ['shape', 'size', 'mode', 'status', 'src_bytes', 'out_bytes', 'wall_ms', 'max_rss_kb']
+
+
+# 用 measure 运行一次编译器, 返回 (status, 墙上时间, 峰值 RSS)
+def run_once(measure, cmd, timeout):
+    res = subprocess.run([measure, str(int(timeout))] + cmd, stdout=subprocess.PIPE, text=True, check=True)
+    status, wall_ms, rss = res.stdout.split()
+    if status.startswith('signal:'):
+        status = 'signal:' + signal.Signals(int(status[7:])).name
+    return status, float(wall_ms), int(rss)
+
+
+def bench_one(measure, compiler, src, mode, out, repeat, timeout):
+    cmd = [compiler, '-' + mode, src, '-o', out]
+    walls = []
+    rss = 0
+    status = 'ok'
+    for _ in range(repeat):
+        if os.path.exists(out):
+            os.remove(out)
+        status, wall, maxrss = run_once(measure, cmd, timeout)
+        walls.append(wall)
+        rss = max(rss, maxrss)
+        if status != 'ok':
+            break
+    walls.sort()
+    out_bytes = os.path.getsize(out) if status == 'ok' and os.path.exists(out) else 0
+    return {
+        'mode': mode,
+        'status': status,
+        'out_bytes': out_bytes,
+        'wall_ms': '%.2f' % walls[len(walls) // 2],
+        'max_rss_kb': rss,
+    }
+
+
+def load_csv(path):
+    with open(path) as f:
+        return {(r['shape'], r['size'], r['mode']): r for r in csv.DictReader(f)}
+
+
+# 和之前的结果比较, 输出耗时和内存的比值
+def compare(rows, baseline):
+    old = load_csv(baseline)
+    print('%-8s %8s %-6s %10s %10s' % ('shape', 'size', 'mode', 'time', 'rss'))
+    for r in rows:
+        o = old.get((r['shape'], str(r['size']), r['mode']))
+        if o is None:
+            continue
+        if r['status'] != 'ok' or o['status'] != 'ok':
+            print('%-8s %8s %-6s %21s' % (r['shape'], r['size'], r['mode'], o['status'] + ' -> ' + r['status']))
+            continue
+        t = float(r['wall_ms']) / max(float(o['wall_ms']), 0.01)
+        m = float(r['max_rss_kb']) / max(float(o['max_rss_kb']), 1)
+        print('%-8s %8s %-6s %9.2fx %9.2fx' % (r['shape'], r['size'], r['mode'], t, m))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compile-time benchmark for the SysY compiler')
+    parser.add_argument('-c', '--compiler', default='build/compiler')
+    parser.add_argument('-m', '--measure', default='build/bench/measure', help='measure helper built from bench/measure.c')
+    parser.add_argument('-o', '--output', default='build/bench/results.csv')
+    parser.add_argument('-w', '--workdir', default=None, help='where to put generated programs (default: next to the CSV)')
+    parser.add_argument('-r', '--repeat', type=int, default=3)
+    parser.add_argument('-t', '--timeout', type=float, default=60)
+    parser.add_argument('--shapes', default=','.join(gen_sysy.SHAPES))
+    parser.add_argument('--scale', type=float, default=1, help='multiply every size by this factor')
+    parser.add_argument('--baseline', help='CSV from an earlier run to compare against')
+    args = parser.parse_args()
+
+    workdir = args.workdir or os.path.dirname(os.path.abspath(args.output))
+    os.makedirs(workdir, exist_ok=True)
+    rows = []
+    for shape in args.shapes.split(','):
+        for size in DEFAULT_SIZES[shape]:
+            size = max(1, int(size * args.scale))
+            src = os.path.join(workdir, '%s_%d.c' % (shape, size))
+            with open(src, 'w') as f:
+                f.write(gen_sysy.generate(shape, size))
+            for mode in MODES:
+                out = os.path.join(workdir, '%s_%d.%s' % (shape, size, mode))
+                row = {'shape': shape, 'size': size, 'src_bytes': os.path.getsize(src)}
+                row.update(bench_one(args.measure, args.compiler, src, mode, out, args.repeat, args.timeout))
+                rows.append(row)
+                print('%-8s %8d %-6s %-14s %10s ms %8d KB' %
+                      (shape, size, mode, row['status'], row['wall_ms'], row['max_rss_kb']), flush=True)
+
+    with open(args.output, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=FIELDS, lineterminator='\n')
+        writer.writeheader()
+        writer.writerows(rows)
+    print('results written to ' + args.output)
+    if args.baseline:
+        compare(rows, args.baseline)
+
+
+if __name__ == '__main__':
+    main()
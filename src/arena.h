@@ -0,0 +1,115 @@
+// 线性 (bump) 分配器
+// 一个编译单元的所有 AST 节点都从这里分配, 节点不再单独 delete, 编译结束时整块释放
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+class Arena {
+  public:
+    // 每次向系统申请的内存块大小
+    static const size_t CHUNK_SIZE = 64 * 1024;
+
+    // 分配统计, 用来确认 AST 节点没有逐个 malloc
+    struct Stats {
+      // make() 创建的对象个数
+      size_t objects = 0;
+      // 对象占用的字节数
+      size_t bytes = 0;
+      // 向系统申请内存块 (malloc) 的次数
+      size_t chunks = 0;
+    };
+
+    Arena() = default;
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() {
+      reset();
+    }
+
+    // 在 arena 中构造一个 T, 返回的指针在 reset() 之前一直有效
+    template<typename T, typename... Args>
+    T *make(Args &&...args) {
+      void *mem = allocate(sizeof(T), alignof(T));
+      T *obj = new (mem) T(std::forward<Args>(args)...);
+      // 只有析构函数有实际工作的对象才需要在 reset() 时析构
+      if(!std::is_trivially_destructible<T>::value) {
+        Finalizer *fin = new (allocate(sizeof(Finalizer), alignof(Finalizer))) Finalizer;
+        fin->obj = obj;
+        fin->destroy = [](void *p) { static_cast<T *>(p)->~T(); };
+        fin->next = finalizers;
+        finalizers = fin;
+      }
+      stats_.objects ++;
+      stats_.bytes += sizeof(T);
+      return obj;
+    }
+
+    // 分配 size 字节的未初始化内存
+    void *allocate(size_t size, size_t align) {
+      size_t pos = (cur_pos + align - 1) & ~(align - 1);
+      if(head == NULL || pos + size > head->size) {
+        new_chunk(size + align);
+        pos = (cur_pos + align - 1) & ~(align - 1);
+      }
+      cur_pos = pos + size;
+      return reinterpret_cast<char *>(head) + pos;
+    }
+
+    // 析构所有需要析构的对象, 并一次性释放全部内存块
+    void reset() {
+      for(Finalizer *fin = finalizers; fin != NULL; fin = fin->next) {
+        fin->destroy(fin->obj);
+      }
+      finalizers = NULL;
+      while(head != NULL) {
+        Chunk *next = head->next;
+        free(head);
+        head = next;
+      }
+      cur_pos = 0;
+    }
+
+    const Stats &stats() const {
+      return stats_;
+    }
+
+  private:
+    // 内存块头部, 内存块之间用链表连接
+    struct Chunk {
+      Chunk *next;
+      size_t size;
+    };
+
+    struct Finalizer {
+      void *obj;
+      void (*destroy)(void *);
+      Finalizer *next;
+    };
+
+    void new_chunk(size_t min_size) {
+      size_t size = sizeof(Chunk) + min_size;
+      if(size < CHUNK_SIZE) {
+        size = CHUNK_SIZE;
+      }
+      Chunk *chunk = static_cast<Chunk *>(malloc(size));
+      if(chunk == NULL) {
+        throw std::bad_alloc();
+      }
+      chunk->next = head;
+      chunk->size = size;
+      head = chunk;
+      cur_pos = sizeof(Chunk);
+      stats_.chunks ++;
+    }
+
+    Chunk *head = NULL;
+    // 下一次分配在当前内存块中的偏移
+    size_t cur_pos = 0;
+    Finalizer *finalizers = NULL;
+    Stats stats_;
+};
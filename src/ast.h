@@ -1,109 +1,95 @@
 // 所有头文件都只 include 一次
 #pragma once
 
-#include <memory>
-#include <iostream>
-#include <unordered_map>
+#include <algorithm>
+#include <string_view>
 #include <vector>
+#include "context.h"
+#include "ir.h"
 
-/* 全局变量 */
-
-static int now = 0;
-// 作用域的个数
-const int SCOPE_SIZE = 1000000;
-// 标识符类型表，确定某一个标识符是常量(0)/变量(1)/...
-static std::unordered_map<std::string, int> ident_type[SCOPE_SIZE];
-
-// 符号表部分
-
-// f[i] 表示作用域 i 的上一层作用域的标号
-static int f[SCOPE_SIZE];
-// 表示全部的作用域个数
-static int deep;
-// 表示当前处于哪个作用域
-static int cur_deep;
-// 标识符符号表，会保存作用域中常量的值
-static std::unordered_map<std::string, int> ident_val[SCOPE_SIZE];
-
-/* 函数声明 */
-
-static int find_ident_depth(int deep, std::string ident);
+class BlockAST;
 
 // 所有 AST 的基类
+// AST 节点都分配在编译上下文的 ast_arena 中, 随 arena 一起整块释放, 所以析构函数不是虚函数
+// 子节点用裸指针, 字符串用 string_view 指向字面量; 列表用 vector, 由 arena 在释放时析构
 class BaseAST {
   public:
-    virtual ~BaseAST() = default;
 
-    virtual std::string Dump() const = 0;
+    // 生成 IR, 表达式返回结果的操作数 (整数常量或者指令编号), 其他节点返回 ir_none()
+    // 操作数只在输出 IR 时才格式化成文本, 生成 IR 的过程中不需要构造任何字符串
+    virtual IROperand Dump() const = 0;
     virtual int Calc() {
       return 0;
     }
-    virtual std::string get_ident() {
-      return "";
+    virtual int get_ident() {
+      return -1;
     }
-};
-
-// CompUnit 是 BaseAST
-class CompUnitAST : public BaseAST {
-  public:
-    // 用智能指针管理对象
-    std::unique_ptr<BaseAST> func_def;
-
-    std::string Dump() const override {
-      return func_def->Dump();
+    // 代码块语句 { ... } 返回其中的代码块, 其他节点返回 NULL
+    virtual const BlockAST *get_block() const {
+      return NULL;
     }
+    // 估计表达式生成的指令条数, 用来决定 && 和 || 要不要用分支
+    // 含有不能提前求值的运算 (除法和取模, 除数可能是 0) 时返回 NOT_SPECULATABLE
+    virtual int Cost() {
+      return 0;
+    }
+
+    static constexpr int NOT_SPECULATABLE = 1 << 20;
 };
 
+// 两部分代价相加, 不超过 NOT_SPECULATABLE
+static int add_cost(int a, int b) {
+  return std::min(a + b, BaseAST::NOT_SPECULATABLE);
+}
+
 class DeclAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> decl;
+    BaseAST *decl = NULL;
 
-    std::string Dump() const override {
+    IROperand Dump() const override {
       return decl->Dump();
     }
 };
 
 class ConstDeclAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> btype;
-    std::unique_ptr<BaseAST> const_def;
+    BaseAST *btype = NULL;
+    std::vector<BaseAST *> const_defs;
 
-    std::string Dump() const override {
-      return const_def->Dump();
+    IROperand Dump() const override {
+      for(auto const_def : const_defs) {
+        const_def->Dump();
+      }
+      return ir_none();
     }
 };
 
 class BTypeAST : public BaseAST {
   public:
-    std::string type;
+    std::string_view type;
 
-    std::string Dump() const override {
-      return "";
+    IROperand Dump() const override {
+      return ir_none();
     }
 };
 
 class ConstDefAST : public BaseAST {
   public:
-    std::string ident;
-    std::unique_ptr<BaseAST> constInitVal;
-    std::unique_ptr<BaseAST> const_def;
-
-    std::string Dump() const override {
-      ident_val[cur_deep][ident] = constInitVal->Calc();
-      ident_type[cur_deep][ident] = 0;
-      if(const_def != NULL) {
-        const_def->Dump();
-      }
-      return "";
+    int ident;
+    BaseAST *constInitVal = NULL;
+
+    IROperand Dump() const override {
+      cur_ctx->symbol_table.insert(ident, 0, constInitVal->Calc());
+      return ir_none();
     }
 };
 
 class ConstInitValAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> const_exp;
+    BaseAST *const_exp = NULL;
 
-    std::string Dump() const override {
-      return "";
+    IROperand Dump() const override {
+      return ir_none();
     }
 
     int Calc() override {
@@ -113,40 +99,40 @@ class ConstInitValAST : public BaseAST {
 
 class VarDeclAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> btype;
-    std::unique_ptr<BaseAST> var_def;
+    BaseAST *btype = NULL;
+    std::vector<BaseAST *> var_defs;
 
-    std::string Dump() const override {
-      return var_def->Dump();
+    IROperand Dump() const override {
+      for(auto var_def : var_defs) {
+        var_def->Dump();
+      }
+      return ir_none();
     }
 };
 
 class VarDefAST : public BaseAST {
   public:
-    std::string ident;
-    std::unique_ptr<BaseAST> init_val;
-    std::unique_ptr<BaseAST> var_def;
-
-    std::string Dump() const override {
-      std::string cur_ident = ident + "_" + std::to_string(cur_deep);
-      std::cout << "  @" << cur_ident << " = alloc i32" << std::endl;
-      ident_type[cur_deep][ident] = 1;
+    int ident;
+    BaseAST *init_val = NULL;
+
+    IROperand Dump() const override {
+      // IR 中的变量名只在声明时生成一次, 之后通过 alloc 指令的编号引用变量
+      std::string cur_ident = cur_ctx->interner.name(ident) + "_" + std::to_string(cur_ctx->symbol_table.cur_scope());
+      // 变量在符号表中保存的是它的 alloc 指令的编号
+      int id = cur_ctx->ir_builder.alloc(cur_ident);
+      cur_ctx->symbol_table.insert(ident, 1, id);
       if(init_val != NULL) {
-        std::string res = init_val->Dump();
-        std::cout << "  store " << res << ", @" << cur_ident << std::endl;
-      }
-      if(var_def != NULL) {
-        var_def->Dump();
+        cur_ctx->ir_builder.store(init_val->Dump(), id);
       }
-      return "";
+      return ir_none();
     }
 };
 
 class InitValAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> exp;
+    BaseAST *exp = NULL;
 
-    std::string Dump() const override {
+    IROperand Dump() const override {
       return exp->Dump();
     }
 };
@@ -154,86 +140,79 @@ class InitValAST : public BaseAST {
 // FuncDef 也是 BaseAST
 class FuncDefAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> func_type;
-    std::string ident;
-    std::unique_ptr<BaseAST> block;
+    BaseAST *func_type = NULL;
+    int ident;
+    BaseAST *block = NULL;
 
-    std::string Dump() const override {
-      std::cout << "fun ";
-      std::cout << "@" << ident << "(): ";
+    IROperand Dump() const override {
+      cur_ctx->ir_builder.new_function(cur_ctx->interner.name(ident));
+      cur_ctx->symbol_table.enter_function();
       func_type->Dump();
-      std::cout << "{ " << std::endl;
-      std::cout << "\%entry" << ": " << std::endl;
+      cur_ctx->ir_builder.new_block("entry");
       block->Dump();
-      std::cout << std::endl;
-      std::cout << "} " << std::endl;
-      return "";
+      cur_ctx->ir_builder.end_function();
+      return ir_none();
     }
 };
 
 // ...
 class FuncType : public BaseAST {
   public:
-    std::string _int;
+    std::string_view _int;
 
-    std::string Dump() const override {
-      std::cout << "i32 ";
-      return "";
+    // 返回类型只有 i32, IR 中的函数都按 i32 输出, 这里不需要生成任何东西
+    IROperand Dump() const override {
+      return ir_none();
     }
 };
 
 class BlockAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> block_item;
-
-    std::string Dump() const override {
-      // 进入代码块时新建一个符号表，作为当前的符号表
-      deep ++;
-      f[deep] = cur_deep;
-      cur_deep = deep;
-      block_item->Dump();
-      // 退出代码块时删除刚刚创建的符号表
-      ident_val[cur_deep].clear();
-      cur_deep = f[cur_deep];
-      return "";
-    }
-};
-
-class BlockItemAST : public BaseAST {
-  public:
-    std::unique_ptr<BaseAST> decl;
-    std::unique_ptr<BaseAST> stmt;
-    std::unique_ptr<BaseAST> block_item;
-
-    std::string Dump() const override {
-      if(decl != NULL) {
-        decl->Dump();
-      } else if(stmt != NULL) {
-        stmt->Dump();
-      }
-      if(block_item != NULL) {
-        block_item->Dump();
+    // 代码块中依次出现的 Decl 和 Stmt
+    std::vector<BaseAST *> items;
+
+    // 嵌套的代码块不递归访问, 而是放进显式的栈里, 嵌套得再深也不会让 C++ 栈溢出
+    // 栈中是每一层正在访问的代码块和它下一个要访问的 item 的下标
+    IROperand Dump() const override {
+      std::vector<std::pair<const BlockAST *, size_t>> stack;
+      // 进入代码块时新建一个作用域，作为当前的作用域
+      cur_ctx->symbol_table.enter_scope();
+      stack.emplace_back(this, 0);
+      while(!stack.empty()) {
+        auto &top = stack.back();
+        if(top.second == top.first->items.size()) {
+          // 退出代码块时删除刚刚创建的作用域
+          cur_ctx->symbol_table.exit_scope();
+          stack.pop_back();
+          continue;
+        }
+        BaseAST *item = top.first->items[top.second ++];
+        if(const BlockAST *block = item->get_block()) {
+          cur_ctx->symbol_table.enter_scope();
+          stack.emplace_back(block, 0);
+        } else {
+          item->Dump();
+        }
       }
-      return "";
+      return ir_none();
     }
 };
 
 class StmtAST : public BaseAST {
   public:
     int type;
-    std::unique_ptr<BaseAST> lval;
-    std::unique_ptr<BaseAST> exp;
-    std::unique_ptr<BaseAST> block;
+    BaseAST *lval = NULL;
+    BaseAST *exp = NULL;
+    BaseAST *block = NULL;
 
-    std::string Dump() const override {
-      std::string ident, res;
-      int depth;
+    IROperand Dump() const override {
       if(type == 0) {
-        depth = find_ident_depth(cur_deep, lval->get_ident());
-        if(depth != -1) {
-          ident = lval->get_ident() + "_" + std::to_string(depth);
-          res = exp->Dump();
-          std::cout << "  store " << res << ", @" << ident << std::endl;
+        Symbol *sym = cur_ctx->symbol_table.lookup(lval->get_ident());
+        if(sym != NULL && sym->type == 1) {
+          int dest = sym->val;
+          cur_ctx->ir_builder.store(exp->Dump(), dest);
+        } else if(sym != NULL) {
+          // 抛出异常: 给常量赋值; 常量的 val 不是 alloc 的编号, 不能生成 store
         } else {
           // 抛出异常: 未定义的标识符
         }
@@ -242,41 +221,45 @@ class StmtAST : public BaseAST {
       } else if(type == 3) {
         block->Dump();
       } else if(type == 5) {
-        res = exp->Dump();
-        std::cout << "  ret " << res;
+        cur_ctx->ir_builder.ret(exp->Dump());
       }
-      return "";
+      return ir_none();
+    }
+
+    const BlockAST *get_block() const override {
+      return type == 3 ? static_cast<const BlockAST *>(block) : NULL;
     }
 };
 
 class ExpAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> exp;
+    BaseAST *exp = NULL;
 
-    std::string Dump() const override {
+    IROperand Dump() const override {
       return exp->Dump();
     }
 
     int Calc() override {
       return exp->Calc();
     }
+
+    int Cost() override {
+      return exp->Cost();
+    }
 };
 
 class LValAST : public BaseAST {
   public:
-    std::string ident;
-
-    std::string Dump() const override {
-      std::string res;
-      int depth = find_ident_depth(cur_deep, ident);
-      if(depth != -1) {
-        std::string cur_ident = ident + "_" + std::to_string(depth);
-        if(ident_type[depth][ident] == 0) {
-          res = std::to_string(ident_val[depth][ident]);
-        } else if(ident_type[depth][ident] == 1) {
-          std::cout << "  %" << now << " = load @" << cur_ident << std::endl;
-          res = "%" + std::to_string(now);
-          now ++;
+    int ident;
+
+    IROperand Dump() const override {
+      IROperand res = ir_none();
+      Symbol *sym = cur_ctx->symbol_table.lookup(ident);
+      if(sym != NULL) {
+        if(sym->type == 0) {
+          res = ir_integer(sym->val);
+        } else if(sym->type == 1) {
+          res = ir_value(cur_ctx->ir_builder.load(sym->val));
         }
       } else {
         // 抛出异常: 未定义的标识符
@@ -285,10 +268,10 @@ class LValAST : public BaseAST {
     }
 
     int Calc() override {
-      int depth = find_ident_depth(cur_deep, ident);
-      if(depth != -1) {
-        if(ident_type[depth][ident] == 0) {
-          return ident_val[depth][ident];
+      Symbol *sym = cur_ctx->symbol_table.lookup(ident);
+      if(sym != NULL) {
+        if(sym->type == 0) {
+          return sym->val;
         }
       } else {
         // 抛出异常: 未定义的标识符
@@ -296,30 +279,39 @@ class LValAST : public BaseAST {
       return 0;
     }
 
-    std::string get_ident() override {
+    int get_ident() override {
       return ident;
     }
+
+    int Cost() override {
+      Symbol *sym = cur_ctx->symbol_table.lookup(ident);
+      return sym != NULL && sym->type == 1 ? 1 : 0;
+    }
 };
 
 class PrimaryExpAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> p_exp;
+    BaseAST *p_exp = NULL;
 
-    std::string Dump() const override {
+    IROperand Dump() const override {
       return p_exp->Dump();
     }
 
     int Calc() override {
       return p_exp->Calc();
     }
+
+    int Cost() override {
+      return p_exp->Cost();
+    }
 };
 
 class NumberAST : public BaseAST {
   public:
     int val;
 
-    std::string Dump() const override {
-      return std::to_string(val);
+    IROperand Dump() const override {
+      return ir_integer(val);
     }
 
     int Calc() override {
@@ -329,22 +321,20 @@ class NumberAST : public BaseAST {
 
 class UnaryExpAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> u_exp;
-    std::string op_ident;
+    BaseAST *u_exp = NULL;
+    std::string_view op_ident;
 
-    std::string Dump() const override {
-      std::string res, r;
+    IROperand Dump() const override {
+      IROperand res = ir_none();
       if(op_ident == "" || op_ident == "+") {
         res = u_exp->Dump();
       } else {
-        r = u_exp->Dump();
+        IROperand r = u_exp->Dump();
         if(op_ident == "-") {
-          std::cout << "  %" << now << " = sub 0, " << r << std::endl;
+          res = cur_ctx->ir_builder.binary(IR_SUB, ir_integer(0), r);
         } else if(op_ident == "!") {
-          std::cout << "  %" << now << " = eq 0, " << r << std::endl;
+          res = cur_ctx->ir_builder.binary(IR_EQ, ir_integer(0), r);
         }
-        res = "%" + std::to_string(now);
-        now ++;
       }
       return res;
     }
@@ -361,30 +351,44 @@ class UnaryExpAST : public BaseAST {
       }
       return 0;
     }
+
+    int Cost() override {
+      if(op_ident == "" || op_ident == "+") {
+        return u_exp->Cost();
+      }
+      return add_cost(1, u_exp->Cost());
+    }
 };
 
+// 同一优先级的运算 a - b + c 按左递归建成向左延伸的链, 每个运算符是链上的一个节点
+// 递归访问时每个运算符都要占一层 C++ 栈, 机器生成的很长的表达式会让栈溢出
+// 所以先从链的顶端沿左边的子节点走到运算符为空的节点, 收集链上所有节点 (顶端在前), 再从后往前依次处理
+// 语法保证左边的子节点和 node 是同一种节点
+template<typename T>
+static std::vector<const T *> left_chain(const T *node, BaseAST *T::*left) {
+  std::vector<const T *> chain;
+  while(node->op_ident != "") {
+    chain.push_back(node);
+    node = static_cast<const T *>(node->*left);
+  }
+  chain.push_back(node);
+  return chain;
+}
+
 class MulExpAST : public BaseAST {
   public:
-    std::string op_ident;
-    std::unique_ptr<BaseAST> mul_exp;
-    std::unique_ptr<BaseAST> unary_exp;
+    std::string_view op_ident;
+    BaseAST *mul_exp = NULL;
+    BaseAST *unary_exp = NULL;
 
-    std::string Dump() const override {
-      std::string l, r, res;
+    IROperand Dump() const override {
       if(op_ident == "") {
-        res = unary_exp->Dump();
-      } else {
-        l = mul_exp->Dump();
-        r = unary_exp->Dump();
-        if(op_ident == "*") {
-          std::cout << "  %" << now << " = mul " << l << ", " << r << std::endl;
-        } else if(op_ident == "/") {
-          std::cout << "  %" << now << " = div " << l << ", " << r << std::endl;
-        } else if(op_ident == "%") {
-          std::cout << "  %" << now << " = mod " << l << ", " << r << std::endl;
-        }
-        res = "%" + std::to_string(now);
-        now ++;
+        return unary_exp->Dump();
+      }
+      auto chain = left_chain(this, &MulExpAST::mul_exp);
+      IROperand res = chain.back()->unary_exp->Dump();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->dump_op(res, (*it)->unary_exp->Dump());
       }
       return res;
     }
@@ -392,12 +396,50 @@ class MulExpAST : public BaseAST {
     int Calc() override {
       if(op_ident == "") {
         return unary_exp->Calc();
-      } else if(op_ident == "*") {
-        return mul_exp->Calc() * unary_exp->Calc();
+      }
+      auto chain = left_chain(this, &MulExpAST::mul_exp);
+      int res = chain.back()->unary_exp->Calc();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->calc_op(res, (*it)->unary_exp->Calc());
+      }
+      return res;
+    }
+
+    int Cost() override {
+      if(op_ident == "") {
+        return unary_exp->Cost();
+      }
+      auto chain = left_chain(this, &MulExpAST::mul_exp);
+      int cost = chain.back()->unary_exp->Cost();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        if((*it)->op_ident != "*") {
+          return NOT_SPECULATABLE;
+        }
+        cost = add_cost(1, add_cost(cost, (*it)->unary_exp->Cost()));
+      }
+      return cost;
+    }
+
+  private:
+    // 链上一个节点的运算, l 是左边已经算出的结果
+    IROperand dump_op(IROperand l, IROperand r) const {
+      if(op_ident == "*") {
+        return cur_ctx->ir_builder.binary(IR_MUL, l, r);
+      } else if(op_ident == "/") {
+        return cur_ctx->ir_builder.binary(IR_DIV, l, r);
+      } else if(op_ident == "%") {
+        return cur_ctx->ir_builder.binary(IR_MOD, l, r);
+      }
+      return ir_none();
+    }
+
+    int calc_op(int l, int r) const {
+      if(op_ident == "*") {
+        return l * r;
       } else if(op_ident == "/") {
-        return mul_exp->Calc() / unary_exp->Calc();
+        return l / r;
       } else if(op_ident == "%") {
-        return mul_exp->Calc() % unary_exp->Calc();
+        return l % r;
       }
       return 0;
     }
@@ -405,24 +447,18 @@ class MulExpAST : public BaseAST {
 
 class AddExpAST : public BaseAST {
   public:
-    std::string op_ident;
-    std::unique_ptr<BaseAST> add_exp;
-    std::unique_ptr<BaseAST> mul_exp;
+    std::string_view op_ident;
+    BaseAST *add_exp = NULL;
+    BaseAST *mul_exp = NULL;
 
-    std::string Dump() const override {
-      std::string l, r, res;
+    IROperand Dump() const override {
       if(op_ident == "") {
-        res = mul_exp->Dump();
-      } else {
-        l = add_exp->Dump();
-        r = mul_exp->Dump();
-        if(op_ident == "+") {
-          std::cout << "  %" << now << " = add " << l << ", " << r << std::endl;
-        } else if(op_ident == "-") {
-          std::cout << "  %" << now << " = sub " << l << ", " << r << std::endl;
-        }
-        res = "%" + std::to_string(now);
-        now ++;
+        return mul_exp->Dump();
+      }
+      auto chain = left_chain(this, &AddExpAST::add_exp);
+      IROperand res = chain.back()->mul_exp->Dump();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->dump_op(res, (*it)->mul_exp->Dump());
       }
       return res;
     }
@@ -430,10 +466,42 @@ class AddExpAST : public BaseAST {
     int Calc() override {
       if(op_ident == "") {
         return mul_exp->Calc();
-      } else if(op_ident == "+") {
-        return add_exp->Calc() + mul_exp->Calc();
+      }
+      auto chain = left_chain(this, &AddExpAST::add_exp);
+      int res = chain.back()->mul_exp->Calc();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->calc_op(res, (*it)->mul_exp->Calc());
+      }
+      return res;
+    }
+
+    int Cost() override {
+      if(op_ident == "") {
+        return mul_exp->Cost();
+      }
+      auto chain = left_chain(this, &AddExpAST::add_exp);
+      int cost = chain.back()->mul_exp->Cost();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        cost = add_cost(1, add_cost(cost, (*it)->mul_exp->Cost()));
+      }
+      return cost;
+    }
+
+  private:
+    IROperand dump_op(IROperand l, IROperand r) const {
+      if(op_ident == "+") {
+        return cur_ctx->ir_builder.binary(IR_ADD, l, r);
       } else if(op_ident == "-") {
-        return add_exp->Calc() - mul_exp->Calc();
+        return cur_ctx->ir_builder.binary(IR_SUB, l, r);
+      }
+      return ir_none();
+    }
+
+    int calc_op(int l, int r) const {
+      if(op_ident == "+") {
+        return l + r;
+      } else if(op_ident == "-") {
+        return l - r;
       }
       return 0;
     }
@@ -441,28 +509,18 @@ class AddExpAST : public BaseAST {
 
 class RelExpAST : public BaseAST {
   public:
-    std::string op_ident;
-    std::unique_ptr<BaseAST> rel_exp;
-    std::unique_ptr<BaseAST> add_exp;
+    std::string_view op_ident;
+    BaseAST *rel_exp = NULL;
+    BaseAST *add_exp = NULL;
 
-    std::string Dump() const override {
-      std::string l, r, res;
+    IROperand Dump() const override {
       if(op_ident == "") {
-        res = add_exp->Dump();
-      } else {
-        l = rel_exp->Dump();
-        r = add_exp->Dump();
-        if(op_ident == "<") {
-          std::cout << "  %" << now << " = lt " << l << ", " << r << std::endl;
-        } else if(op_ident == ">") {
-          std::cout << "  %" << now << " = gt " << l << ", " << r << std::endl;
-        } else if(op_ident == "<=") {
-          std::cout << "  %" << now << " = le " << l << ", " << r << std::endl;
-        } else if(op_ident == ">=") {
-          std::cout << "  %" << now << " = ge " << l << ", " << r << std::endl;
-        }
-        res = "%" + std::to_string(now);
-        now ++;
+        return add_exp->Dump();
+      }
+      auto chain = left_chain(this, &RelExpAST::rel_exp);
+      IROperand res = chain.back()->add_exp->Dump();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->dump_op(res, (*it)->add_exp->Dump());
       }
       return res;
     }
@@ -470,14 +528,50 @@ class RelExpAST : public BaseAST {
     int Calc() override {
       if(op_ident == "") {
         return add_exp->Calc();
-      } else if(op_ident == "<") {
-        return rel_exp->Calc() < add_exp->Calc();
+      }
+      auto chain = left_chain(this, &RelExpAST::rel_exp);
+      int res = chain.back()->add_exp->Calc();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->calc_op(res, (*it)->add_exp->Calc());
+      }
+      return res;
+    }
+
+    int Cost() override {
+      if(op_ident == "") {
+        return add_exp->Cost();
+      }
+      auto chain = left_chain(this, &RelExpAST::rel_exp);
+      int cost = chain.back()->add_exp->Cost();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        cost = add_cost(1, add_cost(cost, (*it)->add_exp->Cost()));
+      }
+      return cost;
+    }
+
+  private:
+    IROperand dump_op(IROperand l, IROperand r) const {
+      if(op_ident == "<") {
+        return cur_ctx->ir_builder.binary(IR_LT, l, r);
+      } else if(op_ident == ">") {
+        return cur_ctx->ir_builder.binary(IR_GT, l, r);
+      } else if(op_ident == "<=") {
+        return cur_ctx->ir_builder.binary(IR_LE, l, r);
+      } else if(op_ident == ">=") {
+        return cur_ctx->ir_builder.binary(IR_GE, l, r);
+      }
+      return ir_none();
+    }
+
+    int calc_op(int l, int r) const {
+      if(op_ident == "<") {
+        return l < r;
       } else if(op_ident == ">") {
-        return rel_exp->Calc() > add_exp->Calc();
+        return l > r;
       } else if(op_ident == "<=") {
-        return rel_exp->Calc() <= add_exp->Calc();
+        return l <= r;
       } else if(op_ident == ">=") {
-        return rel_exp->Calc() >= add_exp->Calc();
+        return l >= r;
       }
       return 0;
     }
@@ -485,24 +579,18 @@ class RelExpAST : public BaseAST {
 
 class EqExpAST : public BaseAST {
   public:
-    std::string op_ident;
-    std::unique_ptr<BaseAST> eq_exp;
-    std::unique_ptr<BaseAST> rel_exp;
+    std::string_view op_ident;
+    BaseAST *eq_exp = NULL;
+    BaseAST *rel_exp = NULL;
 
-    std::string Dump() const override {
-      std::string l, r, res;
+    IROperand Dump() const override {
       if(op_ident == "") {
-        res = rel_exp->Dump();
-      } else {
-        l = eq_exp->Dump();
-        r = rel_exp->Dump();
-        if(op_ident == "==") {
-          std::cout << "  %" << now << " = eq " << l << ", " << r << std::endl;
-        } else if(op_ident == "!=") {
-          std::cout << "  %" << now << " = ne " << l << ", " << r << std::endl;
-        }
-        res = "%" + std::to_string(now);
-        now ++;
+        return rel_exp->Dump();
+      }
+      auto chain = left_chain(this, &EqExpAST::eq_exp);
+      IROperand res = chain.back()->rel_exp->Dump();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->dump_op(res, (*it)->rel_exp->Dump());
       }
       return res;
     }
@@ -510,34 +598,103 @@ class EqExpAST : public BaseAST {
     int Calc() override {
       if(op_ident == "") {
         return rel_exp->Calc();
-      } else if(op_ident == "==") {
-        return eq_exp->Calc() == rel_exp->Calc();
+      }
+      auto chain = left_chain(this, &EqExpAST::eq_exp);
+      int res = chain.back()->rel_exp->Calc();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = (*it)->calc_op(res, (*it)->rel_exp->Calc());
+      }
+      return res;
+    }
+
+    int Cost() override {
+      if(op_ident == "") {
+        return rel_exp->Cost();
+      }
+      auto chain = left_chain(this, &EqExpAST::eq_exp);
+      int cost = chain.back()->rel_exp->Cost();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        cost = add_cost(1, add_cost(cost, (*it)->rel_exp->Cost()));
+      }
+      return cost;
+    }
+
+  private:
+    IROperand dump_op(IROperand l, IROperand r) const {
+      if(op_ident == "==") {
+        return cur_ctx->ir_builder.binary(IR_EQ, l, r);
       } else if(op_ident == "!=") {
-        return eq_exp->Calc() != rel_exp->Calc();
+        return cur_ctx->ir_builder.binary(IR_NOT_EQ, l, r);
+      }
+      return ir_none();
+    }
+
+    int calc_op(int l, int r) const {
+      if(op_ident == "==") {
+        return l == r;
+      } else if(op_ident == "!=") {
+        return l != r;
       }
       return 0;
     }
 };
 
+// 右边的表达式可以提前求值, 并且估计不超过这么多条指令时, && 和 || 不用分支, 两边都算出来再 and/or
+// 短路求值需要额外的 store/br/store/jump/load, 还有分支预测失败的风险, 右边很短时不划算
+static const int BRANCHLESS_MAX_COST = 3;
+
+// 把操作数转换成 0/1
+static IROperand to_bool(IROperand opr) {
+  if(cur_ctx->ir_builder.is_bool(opr)) {
+    return opr;
+  }
+  return cur_ctx->ir_builder.binary(IR_NOT_EQ, ir_integer(0), opr);
+}
+
+// 生成 lhs && rhs (is_and 为 true) 或者 lhs || rhs, lhs 是左边已经算出的结果
+static IROperand dump_logic(bool is_and, IROperand lhs, BaseAST *rhs_exp) {
+  // 左边是常量时, 结果要么已经确定, 要么就是右边的值
+  if(lhs.kind == IROperand::INTEGER) {
+    if((lhs.val != 0) != is_and) {
+      return ir_integer(is_and ? 0 : 1);
+    }
+    return to_bool(rhs_exp->Dump());
+  }
+  if(rhs_exp->Cost() <= BRANCHLESS_MAX_COST) {
+    IROperand rhs = rhs_exp->Dump();
+    return cur_ctx->ir_builder.binary(is_and ? IR_AND : IR_OR, to_bool(lhs), to_bool(rhs));
+  }
+  // 短路求值: 结果先存进一个临时变量, 只有左边不能决定结果时才计算右边
+  std::string label = std::string(is_and ? "land_" : "lor_") + std::to_string(cur_ctx->ir_builder.new_label());
+  int res = cur_ctx->ir_builder.alloc(label + "_res");
+  cur_ctx->ir_builder.store(ir_integer(is_and ? 0 : 1), res);
+  int br = cur_ctx->ir_builder.branch(lhs, -1, -1);
+  int rhs_bb = cur_ctx->ir_builder.new_block(label + "_rhs");
+  cur_ctx->ir_builder.store(to_bool(rhs_exp->Dump()), res);
+  int jump = cur_ctx->ir_builder.jump(-1);
+  int end_bb = cur_ctx->ir_builder.new_block(label + "_end");
+  // 跳转目标现在才知道
+  auto &branch = cur_ctx->ir_builder.inst(br).data.branch;
+  branch.true_bb = is_and ? rhs_bb : end_bb;
+  branch.false_bb = is_and ? end_bb : rhs_bb;
+  cur_ctx->ir_builder.inst(jump).data.jump.target = end_bb;
+  return ir_value(cur_ctx->ir_builder.load(res));
+}
+
 class LAndExpAST : public BaseAST {
   public:
-    std::string op_ident;
-    std::unique_ptr<BaseAST> land_exp;
-    std::unique_ptr<BaseAST> eq_exp;
+    std::string_view op_ident;
+    BaseAST *land_exp = NULL;
+    BaseAST *eq_exp = NULL;
 
-    std::string Dump() const override {
-      std::string l, r, res;
+    IROperand Dump() const override {
       if(op_ident == "") {
-        res = eq_exp->Dump();
-      } else if(op_ident == "&&") {
-        l = land_exp->Dump();
-        r = eq_exp->Dump();
-        std::cout << "  %" << now ++ << " = ne 0" << ", " << l << std::endl;
-        std::cout << "  %" << now ++ << " = ne 0" << ", " << r << std::endl;
-        std::cout << "  %" << now << " = add %" << now - 1 << ", %" << now - 2 << std::endl;
-        std::cout << "  %" << now + 1 << " = eq 2" << ", %" << now << std::endl;
-        res = "%" + std::to_string(now + 1);
-        now += 2;
+        return eq_exp->Dump();
+      }
+      auto chain = left_chain(this, &LAndExpAST::land_exp);
+      IROperand res = chain.back()->eq_exp->Dump();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = dump_logic(true, res, (*it)->eq_exp);
       }
       return res;
     }
@@ -545,32 +702,43 @@ class LAndExpAST : public BaseAST {
     int Calc() override {
       if(op_ident == "") {
         return eq_exp->Calc();
-      } else if(op_ident == "&&") {
-        return land_exp->Calc() && eq_exp->Calc();
       }
-      return 0;
+      auto chain = left_chain(this, &LAndExpAST::land_exp);
+      int res = chain.back()->eq_exp->Calc();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = res && (*it)->eq_exp->Calc();
+      }
+      return res;
+    }
+
+    int Cost() override {
+      if(op_ident == "") {
+        return eq_exp->Cost();
+      }
+      auto chain = left_chain(this, &LAndExpAST::land_exp);
+      int cost = chain.back()->eq_exp->Cost();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        // 不用分支时的写法: 两边各一条 ne, 再加一条 and/or
+        cost = add_cost(3, add_cost(cost, (*it)->eq_exp->Cost()));
+      }
+      return cost;
     }
 };
 
 class LOrExpAST : public BaseAST {
   public:
-    std::string op_ident;
-    std::unique_ptr<BaseAST> lor_exp;
-    std::unique_ptr<BaseAST> land_exp;
+    std::string_view op_ident;
+    BaseAST *lor_exp = NULL;
+    BaseAST *land_exp = NULL;
 
-    std::string Dump() const override {
-      std::string l, r, res;
+    IROperand Dump() const override {
       if(op_ident == "") {
-        res = land_exp->Dump();
-      } else if(op_ident == "||") {
-        l = lor_exp->Dump();
-        r = land_exp->Dump();
-        std::cout << "  %" << now ++ << " = ne 0" << ", " << l << std::endl;
-        std::cout << "  %" << now ++ << " = ne 0" << ", " << r << std::endl;
-        std::cout << "  %" << now << " = add %" << now - 1 << ", %" << now - 2 << std::endl;
-        std::cout << "  %" << now + 1 << " = ne 0" << ", %" << now << std::endl;
-        res = "%" + std::to_string(now + 1);
-        now += 2;
+        return land_exp->Dump();
+      }
+      auto chain = left_chain(this, &LOrExpAST::lor_exp);
+      IROperand res = chain.back()->land_exp->Dump();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = dump_logic(false, res, (*it)->land_exp);
       }
       return res;
     }
@@ -578,18 +746,33 @@ class LOrExpAST : public BaseAST {
     int Calc() override {
       if(op_ident == "") {
         return land_exp->Calc();
-      } else if(op_ident == "||") {
-        return lor_exp->Calc() || land_exp->Calc();
       }
-      return 0;
+      auto chain = left_chain(this, &LOrExpAST::lor_exp);
+      int res = chain.back()->land_exp->Calc();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        res = res || (*it)->land_exp->Calc();
+      }
+      return res;
+    }
+
+    int Cost() override {
+      if(op_ident == "") {
+        return land_exp->Cost();
+      }
+      auto chain = left_chain(this, &LOrExpAST::lor_exp);
+      int cost = chain.back()->land_exp->Cost();
+      for(auto it = chain.rbegin() + 1; it != chain.rend(); it ++) {
+        cost = add_cost(3, add_cost(cost, (*it)->land_exp->Cost()));
+      }
+      return cost;
     }
 };
 
 class ConstExpAST : public BaseAST {
   public:
-    std::unique_ptr<BaseAST> exp;
+    BaseAST *exp = NULL;
 
-    std::string Dump() const override {
+    IROperand Dump() const override {
       return exp->Dump();
     }
 
@@ -597,14 +780,3 @@ class ConstExpAST : public BaseAST {
       return exp->Calc();
     }
 };
-
-static int find_ident_depth(int deep, std::string ident) {
-  if(deep == 0) {
-    return -1;
-  }
-  if(ident_type[deep].find(ident) != ident_type[deep].end()) {
-    return deep;
-  } else {
-    return find_ident_depth(f[deep], ident);
-  }
-}
\ No newline at end of file
@@ -0,0 +1,148 @@
+// 控制流图上的分析: 前驱/后继, 逆后序, 支配树, 支配边界
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "ir.h"
+
+// 基本块 bb 的后继基本块的下标
+inline std::vector<int> successors(const IRFunction &func, const IRBasicBlock &bb) {
+  if(bb.insts.empty()) {
+    return {};
+  }
+  const IRInst &last = func.insts[bb.insts.back()];
+  if(last.tag == IR_BRANCH) {
+    return {last.data.branch.true_bb, last.data.branch.false_bb};
+  } else if(last.tag == IR_JUMP) {
+    return {last.data.jump.target};
+  }
+  return {};
+}
+
+struct CFG {
+  // preds[b] 是基本块 b 的前驱 (包括不可达的前驱)
+  std::vector<std::vector<int>> preds;
+  // 从入口可达的基本块的逆后序
+  std::vector<int> rpo;
+  // 基本块在 rpo 中的下标, 不可达的基本块为 -1
+  std::vector<int> rpo_index;
+  // 直接支配者, 入口的直接支配者是它自己, 不可达的基本块为 -1
+  std::vector<int> idom;
+  // 支配树上的孩子
+  std::vector<std::vector<int>> children;
+
+  bool reachable(int bb) const {
+    return rpo_index[bb] != -1;
+  }
+};
+
+// 计算前驱, 逆后序和支配树
+// 支配树用 Cooper, Harvey, Kennedy 的迭代算法 ("A Simple, Fast Dominance Algorithm"):
+// 按逆后序反复用前驱的支配者求交, 直到不再变化
+inline CFG build_cfg(const IRFunction &func) {
+  int nbb = func.bbs.size();
+  CFG cfg;
+  cfg.preds.resize(nbb);
+  for(int b = 0; b < nbb; b ++) {
+    for(int s : successors(func, func.bbs[b])) {
+      cfg.preds[s].push_back(b);
+    }
+  }
+
+  // 非递归的深度优先搜索求后序
+  cfg.rpo_index.assign(nbb, -1);
+  std::vector<bool> visited(nbb);
+  std::vector<std::pair<int, std::vector<int>>> stack;
+  std::vector<int> postorder;
+  if(nbb > 0) {
+    visited[0] = true;
+    stack.emplace_back(0, successors(func, func.bbs[0]));
+  }
+  while(!stack.empty()) {
+    auto &top = stack.back();
+    if(top.second.empty()) {
+      postorder.push_back(top.first);
+      stack.pop_back();
+      continue;
+    }
+    // 后继按原来的顺序访问
+    int s = top.second.front();
+    top.second.erase(top.second.begin());
+    if(!visited[s]) {
+      visited[s] = true;
+      stack.emplace_back(s, successors(func, func.bbs[s]));
+    }
+  }
+  cfg.rpo.assign(postorder.rbegin(), postorder.rend());
+  for(int i = 0; i < (int)cfg.rpo.size(); i ++) {
+    cfg.rpo_index[cfg.rpo[i]] = i;
+  }
+
+  cfg.idom.assign(nbb, -1);
+  cfg.children.resize(nbb);
+  if(nbb == 0) {
+    return cfg;
+  }
+  auto intersect = [&](int a, int b) {
+    while(a != b) {
+      while(cfg.rpo_index[a] > cfg.rpo_index[b]) {
+        a = cfg.idom[a];
+      }
+      while(cfg.rpo_index[b] > cfg.rpo_index[a]) {
+        b = cfg.idom[b];
+      }
+    }
+    return a;
+  };
+  cfg.idom[0] = 0;
+  bool changed = true;
+  while(changed) {
+    changed = false;
+    for(int i = 1; i < (int)cfg.rpo.size(); i ++) {
+      int b = cfg.rpo[i];
+      int new_idom = -1;
+      for(int p : cfg.preds[b]) {
+        if(cfg.idom[p] == -1) {
+          continue;
+        }
+        new_idom = new_idom == -1 ? p : intersect(p, new_idom);
+      }
+      if(new_idom != cfg.idom[b]) {
+        cfg.idom[b] = new_idom;
+        changed = true;
+      }
+    }
+  }
+  for(int b : cfg.rpo) {
+    if(b != 0) {
+      cfg.children[cfg.idom[b]].push_back(b);
+    }
+  }
+  return cfg;
+}
+
+// 每个可达基本块的支配边界
+inline std::vector<std::vector<int>> dominance_frontiers(const IRFunction &func, const CFG &cfg) {
+  int nbb = func.bbs.size();
+  std::vector<std::vector<int>> df(nbb);
+  for(int b : cfg.rpo) {
+    std::vector<int> preds;
+    for(int p : cfg.preds[b]) {
+      if(cfg.reachable(p)) {
+        preds.push_back(p);
+      }
+    }
+    if(preds.size() < 2) {
+      continue;
+    }
+    for(int p : preds) {
+      for(int runner = p; runner != cfg.idom[b]; runner = cfg.idom[runner]) {
+        auto &list = df[runner];
+        if(std::find(list.begin(), list.end(), b) == list.end()) {
+          list.push_back(b);
+        }
+      }
+    }
+  }
+  return df;
+}
@@ -0,0 +1,533 @@
+// 磁盘上的编译缓存
+// 用输入文件的内容, 模式 (-koopa/-riscv) 和编译器版本的哈希值作为 key, 保存编译的输出;
+// 同样的输入再次编译时直接把保存的输出复制到 -o 的文件, 不再经过 lex, parse 和代码生成
+//
+// 缓存目录的结构:
+//   ab/cdef...   key 的 32 位十六进制数中前两位是子目录, 剩下的 30 位是文件名, 内容就是编译的输出
+//   stats        命中/未命中等计数和缓存的总大小, 是可以直接阅读的文本
+// 整个文件的输出和函数级缓存的函数表 (见 FunctionCache) 都是普通的条目, 一起按 LRU 淘汰
+// 新的条目先写进临时文件再 rename, 所以其他进程只会看到完整的条目;
+// 条目的 mtime 是最近一次使用的时间, 总大小超过上限时按 mtime 从旧到新删除 (LRU)
+// 多个进程/线程可以共享同一个缓存目录, stats 的读写用 flock 互斥
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <string>
+#include <sys/file.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+#include "emitter.h"
+
+// 缓存的 key, 128 位的哈希值
+struct CacheKey {
+  uint64_t h[2] = {0, 0};
+
+  // 32 位十六进制数
+  std::string hex() const {
+    char buf[33];
+    snprintf(buf, sizeof(buf), "%016llx%016llx", (unsigned long long)h[0], (unsigned long long)h[1]);
+    return buf;
+  }
+};
+
+// MurmurHash3 的 x64 128 位版本, 每次处理 16 字节
+class Murmur3 {
+  public:
+    static CacheKey hash(const void *data, size_t len, uint64_t seed) {
+      const unsigned char *p = static_cast<const unsigned char *>(data);
+      uint64_t h1 = seed, h2 = seed;
+      size_t blocks = len / 16;
+      for(size_t i = 0; i < blocks; i ++) {
+        uint64_t k1, k2;
+        memcpy(&k1, p + i * 16, 8);
+        memcpy(&k2, p + i * 16 + 8, 8);
+        h1 ^= mix_k1(k1);
+        h1 = rotl(h1, 27) + h2;
+        h1 = h1 * 5 + 0x52dce729;
+        h2 ^= mix_k2(k2);
+        h2 = rotl(h2, 31) + h1;
+        h2 = h2 * 5 + 0x38495ab5;
+      }
+      // 剩下不到 16 字节, 前 8 字节放进 k1, 其余放进 k2
+      uint64_t k1 = 0, k2 = 0;
+      size_t tail = len & 15;
+      for(size_t i = 0; i < tail; i ++) {
+        uint64_t byte = p[blocks * 16 + i];
+        if(i < 8) {
+          k1 ^= byte << (i * 8);
+        } else {
+          k2 ^= byte << ((i - 8) * 8);
+        }
+      }
+      if(tail > 8) {
+        h2 ^= mix_k2(k2);
+      }
+      if(tail > 0) {
+        h1 ^= mix_k1(k1);
+      }
+      h1 ^= len;
+      h2 ^= len;
+      h1 += h2;
+      h2 += h1;
+      h1 = fmix(h1);
+      h2 = fmix(h2);
+      h1 += h2;
+      h2 += h1;
+      CacheKey key;
+      key.h[0] = h1;
+      key.h[1] = h2;
+      return key;
+    }
+
+  private:
+    static const uint64_t C1 = 0x87c37b91114253d5ull;
+    static const uint64_t C2 = 0x4cf5ad432745937full;
+
+    static uint64_t rotl(uint64_t x, int r) {
+      return (x << r) | (x >> (64 - r));
+    }
+
+    static uint64_t mix_k1(uint64_t k) {
+      return rotl(k * C1, 31) * C2;
+    }
+
+    static uint64_t mix_k2(uint64_t k) {
+      return rotl(k * C2, 33) * C1;
+    }
+
+    static uint64_t fmix(uint64_t k) {
+      k ^= k >> 33;
+      k *= 0xff51afd7ed558ccdull;
+      k ^= k >> 33;
+      k *= 0xc4ceb9fe1a85ec53ull;
+      k ^= k >> 33;
+      return k;
+    }
+};
+
+class CompileCache {
+  public:
+    // 保存在 stats 文件中的计数, 由所有使用这个目录的编译累计
+    struct Stats {
+      size_t hits = 0;
+      size_t misses = 0;
+      size_t stores = 0;
+      size_t evictions = 0;
+      // 函数级缓存中命中和未命中的函数个数
+      size_t func_hits = 0;
+      size_t func_misses = 0;
+      // 所有条目的总字节数
+      size_t bytes = 0;
+    };
+
+    // 默认的总大小上限
+    static const size_t DEFAULT_LIMIT = (size_t)512 << 20;
+
+    // dir 是缓存目录, 不存在时创建; limit 是所有条目的总大小上限 (字节)
+    // 编译器的版本用可执行文件本身的 inode, 大小和修改时间表示, 重新构建编译器后旧的条目自然失效
+    CompileCache(const std::string &dir, size_t limit) : dir(dir), limit(limit) {
+      mkdir(dir.c_str(), 0755);
+      struct stat st;
+      if(stat("/proc/self/exe", &st) == 0) {
+        version = std::to_string(st.st_ino) + ':' + std::to_string(st.st_size) + ':' +
+                  std::to_string(st.st_mtim.tv_sec) + '.' + std::to_string(st.st_mtim.tv_nsec);
+      }
+      version += ":" + std::to_string(FORMAT_VERSION);
+    }
+
+    CompileCache(const CompileCache &) = delete;
+    CompileCache &operator=(const CompileCache &) = delete;
+
+    // 用 mode 编译的 key 的 seed, 由模式和版本决定, 所以同一个文件的不同模式/版本得到不同的 key
+    uint64_t seed(const char *mode) const {
+      std::string prefix = std::string(mode) + '\0' + version;
+      return Murmur3::hash(prefix.data(), prefix.size(), 0).h[0];
+    }
+
+    // 计算用 mode 编译 input 的 key, 读取输入文件失败时返回 false
+    bool key(const char *mode, const char *input, CacheKey &key) const {
+      int fd = open(input, O_RDONLY);
+      if(fd < 0) {
+        return false;
+      }
+      struct stat st;
+      bool ok = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+      if(ok) {
+        if(st.st_size == 0) {
+          key = Murmur3::hash(NULL, 0, seed(mode));
+        } else {
+          void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+          ok = p != MAP_FAILED;
+          if(ok) {
+            key = Murmur3::hash(p, st.st_size, seed(mode));
+            munmap(p, st.st_size);
+          }
+        }
+      }
+      close(fd);
+      return ok;
+    }
+
+    // 查找 key, 命中时把保存的输出复制到 output 并返回 true
+    bool fetch(const CacheKey &key, const char *output) {
+      int in = open_entry(key);
+      bool hit = false;
+      if(in >= 0) {
+        struct stat st;
+        int out = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if(out >= 0) {
+          hit = fstat(in, &st) == 0 && copy_file(in, out, st.st_size);
+          hit = close(out) == 0 && hit;
+          if(!hit) {
+            unlink(output);
+          }
+        }
+        close(in);
+      }
+      update_stats([&](Stats &stats) {
+        if(hit) {
+          stats.hits ++;
+        } else {
+          stats.misses ++;
+        }
+      });
+      return hit;
+    }
+
+    // 把编译好的 output 保存为 key 的条目, 失败时什么都不做
+    void store(const CacheKey &key, const char *output) {
+      int in = open(output, O_RDONLY);
+      if(in < 0) {
+        return;
+      }
+      std::string tmp;
+      struct stat st;
+      int out = create_entry(key, tmp);
+      bool ok = out >= 0 && fstat(in, &st) == 0 && copy_file(in, out, st.st_size);
+      close(in);
+      commit_entry(key, out, tmp, ok);
+    }
+
+    // 打开 key 的条目用来读取, 并且更新它的 mtime, 记录这个条目刚刚用过; 没有这个条目时返回 -1
+    int open_entry(const CacheKey &key) {
+      int fd = open(entry_path(key).c_str(), O_RDONLY);
+      if(fd >= 0) {
+        futimens(fd, NULL);
+      }
+      return fd;
+    }
+
+    // 新的条目先写进临时文件, 返回它的 fd, 路径写进 tmp; 写完以后调用 commit_entry
+    int create_entry(const CacheKey &key, std::string &tmp) {
+      std::string path = entry_path(key);
+      mkdir(path.substr(0, path.size() - KEY_FILE_LEN - 1).c_str(), 0755);
+      // 临时文件名包含进程号和进程内的序号, 同时保存同一个 key 的编译不会互相覆盖
+      static std::atomic<unsigned> seq{0};
+      tmp = path + ".tmp." + std::to_string(getpid()) + '.' + std::to_string(seq ++);
+      return open(tmp.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    }
+
+    // 关闭 create_entry 返回的 fd; ok 为 true 时把临时文件 rename 成 key 的条目, 否则删除它
+    void commit_entry(const CacheKey &key, int fd, const std::string &tmp, bool ok) {
+      struct stat st;
+      if(fd >= 0) {
+        ok = fstat(fd, &st) == 0 && ok;
+        ok = close(fd) == 0 && ok;
+      }
+      if(fd < 0 || !ok || rename(tmp.c_str(), entry_path(key).c_str()) != 0) {
+        unlink(tmp.c_str());
+        return;
+      }
+      update_stats([&](Stats &stats) {
+        stats.stores ++;
+        stats.bytes += st.st_size;
+        if(stats.bytes > limit) {
+          evict(stats);
+        }
+      });
+    }
+
+    // 记录一次编译中函数级缓存命中和未命中的函数个数
+    void count_functions(size_t hits, size_t misses) {
+      update_stats([&](Stats &stats) {
+        stats.func_hits += hits;
+        stats.func_misses += misses;
+      });
+    }
+
+  private:
+    // 条目格式变化时修改这个值, 让旧的条目失效
+    static const int FORMAT_VERSION = 1;
+    // 条目的文件名长度, 另外两位十六进制数是子目录名
+    static const size_t KEY_FILE_LEN = 30;
+
+    std::string dir;
+    size_t limit;
+    std::string version;
+
+    std::string entry_path(const CacheKey &key) const {
+      std::string hex = key.hex();
+      return dir + '/' + hex.substr(0, 2) + '/' + hex.substr(2);
+    }
+
+    // 在 stats 文件的锁内读出计数, 交给 f 修改后写回
+    template<typename F>
+    void update_stats(F f) {
+      int fd = open((dir + "/stats").c_str(), O_RDWR | O_CREAT, 0644);
+      if(fd < 0) {
+        return;
+      }
+      flock(fd, LOCK_EX);
+      Stats stats;
+      char buf[256];
+      ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+      if(n > 0) {
+        buf[n] = '\0';
+        sscanf(buf, "hits %zu\nmisses %zu\nstores %zu\nevictions %zu\nfunc_hits %zu\nfunc_misses %zu\nbytes %zu",
+               &stats.hits, &stats.misses, &stats.stores, &stats.evictions,
+               &stats.func_hits, &stats.func_misses, &stats.bytes);
+      }
+      f(stats);
+      n = snprintf(buf, sizeof(buf), "hits %zu\nmisses %zu\nstores %zu\nevictions %zu\nfunc_hits %zu\nfunc_misses %zu\nbytes %zu\n",
+                   stats.hits, stats.misses, stats.stores, stats.evictions,
+                   stats.func_hits, stats.func_misses, stats.bytes);
+      // 写入失败只会让计数不准确, 条目本身不受影响
+      if(pwrite(fd, buf, n, 0) != n || ftruncate(fd, n) != 0) {
+        perror((dir + "/stats").c_str());
+      }
+      flock(fd, LOCK_UN);
+      close(fd);
+    }
+
+    // 删除最久没有用过的条目, 直到总大小不超过上限的 90%, 留出余量避免每次保存都要扫描
+    // 扫描时顺便重新统计总大小, 纠正并发保存同一个 key 等情况造成的误差
+    // 在 stats 的锁内调用, 所以同时只有一个进程在删除
+    void evict(Stats &stats) {
+      struct Entry {
+        struct timespec mtime;
+        size_t size;
+        std::string path;
+      };
+      std::vector<Entry> entries;
+      size_t total = 0;
+      DIR *top = opendir(dir.c_str());
+      if(top == NULL) {
+        return;
+      }
+      while(struct dirent *sub = readdir(top)) {
+        if(strlen(sub->d_name) != 2 || sub->d_name[0] == '.') {
+          continue;
+        }
+        std::string sub_path = dir + '/' + sub->d_name;
+        DIR *d = opendir(sub_path.c_str());
+        if(d == NULL) {
+          continue;
+        }
+        while(struct dirent *ent = readdir(d)) {
+          // 跳过临时文件和其他不是条目的文件
+          if(strlen(ent->d_name) != KEY_FILE_LEN) {
+            continue;
+          }
+          std::string path = sub_path + '/' + ent->d_name;
+          struct stat st;
+          if(stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            entries.push_back(Entry{st.st_mtim, (size_t)st.st_size, path});
+            total += st.st_size;
+          }
+        }
+        closedir(d);
+      }
+      closedir(top);
+
+      std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return a.mtime.tv_sec != b.mtime.tv_sec ? a.mtime.tv_sec < b.mtime.tv_sec : a.mtime.tv_nsec < b.mtime.tv_nsec;
+      });
+      size_t target = limit / 10 * 9;
+      for(const auto &entry : entries) {
+        if(total <= target) {
+          break;
+        }
+        if(unlink(entry.path.c_str()) == 0) {
+          total -= entry.size;
+          stats.evictions ++;
+        }
+      }
+      stats.bytes = total;
+    }
+
+    // 把 in 的 size 字节复制到 out
+    // 先试 FICLONE, 支持 reflink 的文件系统 (btrfs, xfs) 上两个文件共享数据块, 不用真正复制;
+    // 不支持时用 copy_file_range 在内核里复制, 最后退回 read/write
+    static bool copy_file(int in, int out, size_t size) {
+#ifdef FICLONE
+      if(ioctl(out, FICLONE, in) == 0) {
+        return true;
+      }
+#endif
+      size_t done = 0;
+#ifdef __linux__
+      while(done < size) {
+        ssize_t n = copy_file_range(in, NULL, out, NULL, size - done, 0);
+        if(n <= 0) {
+          break;
+        }
+        done += n;
+      }
+      if(done == size) {
+        return true;
+      }
+#endif
+      char buf[1 << 16];
+      while(done < size) {
+        ssize_t n = pread(in, buf, sizeof(buf), done);
+        if(n <= 0) {
+          return false;
+        }
+        for(ssize_t w = 0; w < n; ) {
+          ssize_t m = pwrite(out, buf + w, n - w, done + w);
+          if(m < 0) {
+            return false;
+          }
+          w += m;
+        }
+        done += n;
+      }
+      return true;
+    }
+};
+
+// 函数级的缓存
+// 每个输入文件 (按路径) 在 CompileCache 中有一个函数表, 记录上次编译时每个函数的 key 和输出;
+// 再次编译时 token 序列没有变化的函数直接使用上次的输出, 不再生成 IR 和代码, 所以编译时间只和改动的函数有关
+// 函数的 key 是它的 token 序列的哈希; 目前的 SysY 子集中没有全局变量和函数调用, 函数的输出只取决于它自己,
+// 以后加入这些特性时, key 中还要加上函数用到的全局变量和被调用的函数的签名
+// 函数表由若干条记录组成, 每条是 16 字节的 key, 8 字节的长度和函数的输出
+class FunctionCache {
+  public:
+    // 读入 input 上次编译时留下的函数表, 同时开始写新的函数表
+    FunctionCache(CompileCache &cache, const char *mode, const char *input) : cache(cache), out(1 << 16) {
+      char *path = realpath(input, NULL);
+      std::string name = std::string("functions ") + (path != NULL ? path : input);
+      free(path);
+      table_key = Murmur3::hash(name.data(), name.size(), cache.seed(mode));
+      load();
+      fd = cache.create_entry(table_key, tmp);
+    }
+
+    FunctionCache(const FunctionCache &) = delete;
+    FunctionCache &operator=(const FunctionCache &) = delete;
+
+    ~FunctionCache() {
+      if(fd >= 0) {
+        cache.commit_entry(table_key, fd, tmp, false);
+      }
+      if(table != NULL) {
+        munmap(const_cast<char *>(table), table_size);
+      }
+    }
+
+    // 函数的 key
+    static CacheKey key(std::string_view tokens) {
+      return Murmur3::hash(tokens.data(), tokens.size(), 0);
+    }
+
+    // 在旧的函数表中查找函数, 命中时 text 指向它的输出
+    bool find(const CacheKey &key, std::string_view &text) {
+      auto it = index.find(key.h[0]);
+      if(it == index.end() || read_u64(table + it->second + 8) != key.h[1]) {
+        misses ++;
+        return false;
+      }
+      hits ++;
+      text = std::string_view(table + it->second + HEADER_SIZE, read_u64(table + it->second + 16));
+      return true;
+    }
+
+    // 把函数的输出追加到新的函数表, 函数的顺序和输入文件中相同
+    void add(const CacheKey &key, std::string_view text) {
+      uint64_t header[3] = {key.h[0], key.h[1], text.size()};
+      out << std::string_view(reinterpret_cast<const char *>(header), sizeof(header)) << text;
+      if(out.size() >= WRITE_SIZE) {
+        write();
+      }
+    }
+
+    // 编译成功以后调用, 用新的函数表代替旧的
+    void commit() {
+      write();
+      cache.commit_entry(table_key, fd, tmp, ok);
+      fd = -1;
+      cache.count_functions(hits, misses);
+    }
+
+  private:
+    static const size_t HEADER_SIZE = 24;
+    // 新的函数表攒够这么多字节就写进文件
+    static const size_t WRITE_SIZE = 1 << 20;
+
+    CompileCache &cache;
+    CacheKey table_key;
+    // 旧的函数表, 映射进内存
+    const char *table = NULL;
+    size_t table_size = 0;
+    // key 的前 64 位到记录在 table 中的偏移
+    std::unordered_map<uint64_t, size_t> index;
+    // 新的函数表的临时文件
+    int fd = -1;
+    std::string tmp;
+    Emitter out;
+    bool ok = true;
+    size_t hits = 0;
+    size_t misses = 0;
+
+    static uint64_t read_u64(const char *p) {
+      uint64_t val;
+      memcpy(&val, p, 8);
+      return val;
+    }
+
+    // 映射旧的函数表并建立索引, 表不存在或者被截断时只使用完整的记录
+    void load() {
+      int in = cache.open_entry(table_key);
+      if(in < 0) {
+        return;
+      }
+      struct stat st;
+      if(fstat(in, &st) == 0 && st.st_size > 0) {
+        void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, in, 0);
+        if(p != MAP_FAILED) {
+          table = static_cast<const char *>(p);
+          table_size = st.st_size;
+        }
+      }
+      close(in);
+      size_t pos = 0;
+      while(pos + HEADER_SIZE <= table_size) {
+        uint64_t len = read_u64(table + pos + 16);
+        if(len > table_size - pos - HEADER_SIZE) {
+          break;
+        }
+        index.emplace(read_u64(table + pos), pos);
+        pos += HEADER_SIZE + len;
+      }
+    }
+
+    void write() {
+      ok = ok && fd >= 0 && out.write_all(fd);
+      out.clear();
+    }
+};
@@ -0,0 +1,62 @@
+// 编译上下文: 编译一个输入文件用到的所有状态
+// 批量模式下多个文件在不同线程上同时编译, 每个线程同时只编译一个文件,
+// 所以当前的上下文用 thread_local 的指针 cur_ctx 访问, 编译不同文件的线程之间不共享任何可变状态
+#pragma once
+
+#include "arena.h"
+#include "dce.h"
+#include "gvn.h"
+#include "interner.h"
+#include "ir.h"
+#include "mem2reg.h"
+#include "peephole.h"
+#include "stats.h"
+#include "symbol_table.h"
+
+struct CompileContext {
+  // AST 节点使用的 arena
+  Arena ast_arena;
+  // 标识符的驻留表
+  Interner interner;
+  // 符号表
+  SymbolTable symbol_table;
+  // 前端生成的 IR
+  IRBuilder ir_builder;
+  Mem2Reg mem2reg;
+  GVN gvn;
+  DCE dce;
+  Peephole peephole;
+  // 后端的统计信息
+  struct BackendStats {
+    // 栈帧中给溢出的值和 alloc 分配的栈位置
+    size_t stack_slots = 0;
+    // 窥孔优化之后输出的 RISC-V 指令 (包括标号)
+    size_t insts = 0;
+  } backend_stats;
+  // 已经输出的 IR 和代码的统计; 每批函数输出以后 IR 就被释放了, 所以要边编译边累计
+  struct OutputStats {
+    size_t ir_funcs = 0;
+    size_t ir_blocks = 0;
+    size_t ir_insts = 0;
+    size_t bytes = 0;
+    // 直接使用函数级缓存中的输出, 没有生成 IR 的函数
+    size_t reused_funcs = 0;
+  } output_stats;
+  // 输出是从编译缓存中复制的
+  bool cache_hit = false;
+  // 用 flex 生成的 lexer 代替 FastLexer
+  bool flex_lexer = false;
+  // 后端同时生成各个函数的代码时使用的线程数
+  size_t backend_threads = 1;
+  // -stats 的报告
+  StatsReport stats_report;
+};
+
+// 当前线程正在使用的编译上下文
+inline thread_local CompileContext *cur_ctx = NULL;
+
+// 在当前线程上切换到上下文 ctx, NULL 表示离开当前上下文
+inline void enter_context(CompileContext *ctx) {
+  cur_ctx = ctx;
+  cur_report = ctx != NULL ? &ctx->stats_report : NULL;
+}
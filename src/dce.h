@@ -0,0 +1,208 @@
+// 死代码删除 (DCE)
+// 先删除从入口不可达的基本块 (包括 ret 之后的语句所在的基本块), 再从有副作用的指令出发标记用到的值:
+// br 的条件和 ret 的值一定有用; 有用的 load 读取的 alloc 有用, 写入有用的 alloc 的 store 也有用;
+// 有用的基本块参数在每个跳到它的 jump 上对应的参数有用
+// 最后删除没有标记的指令和基本块参数, 例如值没有被用到的表达式语句, 以及只写不读的变量的 alloc 和 store
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "cfg.h"
+#include "ir.h"
+
+class DCE {
+  public:
+    struct Stats {
+      // 删除的不可达基本块
+      size_t blocks = 0;
+      // 删除的没有用到的运算和 load, 以及不可达基本块中的指令
+      size_t insts = 0;
+      // 删除的只写不读的 alloc 和写入它们的 store
+      size_t allocs = 0;
+      size_t stores = 0;
+      // 删除的基本块参数
+      size_t block_args = 0;
+    };
+
+    void run(IRFunction &func) {
+      remove_unreachable(func);
+      std::vector<bool> live = mark(func);
+      sweep(func, live);
+    }
+
+    const Stats &stats() const {
+      return stats_;
+    }
+
+  private:
+    Stats stats_;
+
+    // 删除从入口不可达的基本块, 并且更新 br/jump 中基本块的下标
+    void remove_unreachable(IRFunction &func) {
+      int nbb = func.bbs.size();
+      std::vector<bool> reachable(nbb);
+      std::vector<int> work;
+      if(nbb > 0) {
+        reachable[0] = true;
+        work.push_back(0);
+      }
+      while(!work.empty()) {
+        int b = work.back();
+        work.pop_back();
+        for(int s : successors(func, func.bbs[b])) {
+          if(!reachable[s]) {
+            reachable[s] = true;
+            work.push_back(s);
+          }
+        }
+      }
+      std::vector<int> new_index(nbb, -1);
+      std::vector<IRBasicBlock> bbs;
+      for(int b = 0; b < nbb; b ++) {
+        if(reachable[b]) {
+          new_index[b] = bbs.size();
+          bbs.push_back(std::move(func.bbs[b]));
+        } else {
+          stats_.blocks ++;
+          stats_.insts += func.bbs[b].insts.size();
+        }
+      }
+      if((int)bbs.size() == nbb) {
+        func.bbs = std::move(bbs);
+        return;
+      }
+      for(auto &bb : bbs) {
+        if(bb.insts.empty()) {
+          continue;
+        }
+        IRInst &last = func.insts[bb.insts.back()];
+        if(last.tag == IR_BRANCH) {
+          last.data.branch.true_bb = new_index[last.data.branch.true_bb];
+          last.data.branch.false_bb = new_index[last.data.branch.false_bb];
+        } else if(last.tag == IR_JUMP) {
+          last.data.jump.target = new_index[last.data.jump.target];
+        }
+      }
+      func.bbs = std::move(bbs);
+    }
+
+    // 标记有用的值, 返回的下标是指令编号; br/jump/ret 和 store 不在这里标记
+    std::vector<bool> mark(const IRFunction &func) {
+      int nbb = func.bbs.size();
+      int n = func.insts.size();
+      // 参数所在的基本块和它是第几个参数
+      std::vector<int> owner(n, -1), index(n, -1);
+      for(int b = 0; b < nbb; b ++) {
+        for(int i = 0; i < (int)func.bbs[b].params.size(); i ++) {
+          owner[func.bbs[b].params[i]] = b;
+          index[func.bbs[b].params[i]] = i;
+        }
+      }
+      // 跳到每个基本块的 jump, 以及写入每个 alloc 的 store
+      std::vector<std::vector<int>> jumps(nbb), stores(n);
+      std::vector<bool> live(n);
+      std::vector<int> work;
+      auto use = [&](const IROperand &opr) {
+        if(opr.kind == IROperand::VALUE && !live[opr.val]) {
+          live[opr.val] = true;
+          work.push_back(opr.val);
+        }
+      };
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.insts) {
+          const IRInst &inst = func.insts[id];
+          switch(inst.tag) {
+            case IR_STORE:
+              stores[inst.data.store.dest].push_back(id);
+              break;
+            case IR_BRANCH:
+              use(inst.data.branch.cond);
+              break;
+            case IR_JUMP:
+              jumps[inst.data.jump.target].push_back(id);
+              break;
+            case IR_RETURN:
+              use(inst.data.ret.value);
+              break;
+            default:
+              break;
+          }
+        }
+      }
+      while(!work.empty()) {
+        int v = work.back();
+        work.pop_back();
+        const IRInst &inst = func.insts[v];
+        switch(inst.tag) {
+          case IR_ALLOC:
+            for(int id : stores[v]) {
+              use(func.insts[id].data.store.value);
+            }
+            break;
+          case IR_LOAD:
+            use(ir_value(inst.data.load.src));
+            break;
+          case IR_BINARY:
+            use(inst.data.binary.lhs);
+            use(inst.data.binary.rhs);
+            break;
+          case IR_BLOCK_ARG:
+            for(int id : jumps[owner[v]]) {
+              use(func.jump_args[func.insts[id].data.jump.args + index[v]]);
+            }
+            break;
+          default:
+            break;
+        }
+      }
+      return live;
+    }
+
+    // 删除没有标记的指令和基本块参数
+    void sweep(IRFunction &func, const std::vector<bool> &live) {
+      // 先按目标基本块原来的参数去掉 jump 上没用的参数, 参数在 jump_args 中是连续存放的, 原地去掉
+      for(auto &bb : func.bbs) {
+        if(bb.insts.empty() || func.insts[bb.insts.back()].tag != IR_JUMP) {
+          continue;
+        }
+        IRJump &jump = func.insts[bb.insts.back()].data.jump;
+        const auto &params = func.bbs[jump.target].params;
+        int k = 0;
+        for(int i = 0; i < jump.arg_num; i ++) {
+          if(live[params[i]]) {
+            func.jump_args[jump.args + k ++] = func.jump_args[jump.args + i];
+          }
+        }
+        jump.arg_num = k;
+      }
+      for(auto &bb : func.bbs) {
+        std::vector<int> params;
+        for(int p : bb.params) {
+          if(live[p]) {
+            params.push_back(p);
+          } else {
+            stats_.block_args ++;
+          }
+        }
+        bb.params = std::move(params);
+        std::vector<int> insts;
+        for(int id : bb.insts) {
+          const IRInst &inst = func.insts[id];
+          bool keep = live[id] || ir_is_terminator(inst);
+          if(inst.tag == IR_STORE) {
+            keep = live[inst.data.store.dest];
+            stats_.stores += !keep;
+          } else if(inst.tag == IR_ALLOC) {
+            stats_.allocs += !keep;
+          } else {
+            stats_.insts += !keep;
+          }
+          if(keep) {
+            insts.push_back(id);
+          }
+        }
+        bb.insts = std::move(insts);
+      }
+    }
+};
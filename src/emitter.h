@@ -0,0 +1,141 @@
+// 输出缓冲区
+// 生成的 Koopa IR / RISC-V 先写进一块连续的内存, 攒够一批函数再一次性写到输出文件,
+// 避免像 std::endl 那样每输出一行就刷新一次
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+
+class Emitter {
+  public:
+    // initial_size 是缓冲区的初始容量, 只保存一小段代码的缓冲区可以取小一些
+    explicit Emitter(size_t initial_size = INITIAL_SIZE) {
+      grow(initial_size);
+    }
+
+    Emitter(const Emitter &) = delete;
+    Emitter &operator=(const Emitter &) = delete;
+
+    ~Emitter() {
+      free(buf);
+    }
+
+    Emitter &operator<<(std::string_view str) {
+      append(str.data(), str.size());
+      return *this;
+    }
+
+    Emitter &operator<<(const char *str) {
+      append(str, strlen(str));
+      return *this;
+    }
+
+    Emitter &operator<<(const std::string &str) {
+      append(str.data(), str.size());
+      return *this;
+    }
+
+    // 追加另一个缓冲区的全部内容
+    Emitter &operator<<(const Emitter &other) {
+      append(other.buf, other.len);
+      return *this;
+    }
+
+    Emitter &operator<<(char ch) {
+      reserve(1);
+      buf[len ++] = ch;
+      return *this;
+    }
+
+    Emitter &operator<<(int val) {
+      // 从低位往高位每次转换两位数字
+      static const char digits[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+      char tmp[16];
+      char *end = tmp + sizeof(tmp);
+      char *p = end;
+      unsigned int u = val < 0 ? 0u - (unsigned int)val : (unsigned int)val;
+      while(u >= 100) {
+        unsigned int r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, digits + r * 2, 2);
+      }
+      if(u >= 10) {
+        p -= 2;
+        memcpy(p, digits + u * 2, 2);
+      } else {
+        *-- p = '0' + u;
+      }
+      if(val < 0) {
+        *-- p = '-';
+      }
+      append(p, end - p);
+      return *this;
+    }
+
+    const char *data() const {
+      return buf;
+    }
+
+    size_t size() const {
+      return len;
+    }
+
+    // 清空内容, 保留已经分配的容量
+    void clear() {
+      len = 0;
+    }
+
+    // 把缓冲区的全部内容写进 fd, write 可能只写入一部分, 所以要循环
+    bool write_all(int fd) const {
+      size_t done = 0;
+      while(done < len) {
+        ssize_t n = write(fd, buf + done, len - done);
+        if(n < 0) {
+          return false;
+        }
+        done += n;
+      }
+      return true;
+    }
+
+  private:
+    static const size_t INITIAL_SIZE = 1 << 20;
+
+    void append(const char *str, size_t n) {
+      reserve(n);
+      memcpy(buf + len, str, n);
+      len += n;
+    }
+
+    void reserve(size_t n) {
+      if(len + n > cap) {
+        grow(len + n);
+      }
+    }
+
+    // 容量至少翻倍, 保证追加的均摊开销是 O(1)
+    void grow(size_t min_cap) {
+      size_t new_cap = cap * 2;
+      if(new_cap < min_cap) {
+        new_cap = min_cap;
+      }
+      char *new_buf = static_cast<char *>(realloc(buf, new_cap));
+      if(new_buf == NULL) {
+        throw std::bad_alloc();
+      }
+      buf = new_buf;
+      cap = new_cap;
+    }
+
+    char *buf = NULL;
+    size_t len = 0;
+    size_t cap = 0;
+};
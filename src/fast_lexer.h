@@ -0,0 +1,379 @@
+// 手写的 lexer
+// 输入文件用 mmap 映射进内存, 空白符和注释用 SIMD 一次检查 16 (SSE2) 或 32 (AVX2) 个字节跳过,
+// 关键字用完美哈希识别; token 只记录它在缓冲区中的位置, 不复制文本
+// 输出的 token 序列 (种类, 值和行号) 和 sysy.l 中 flex 生成的 lexer 完全相同
+#pragma once
+
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#define FAST_LEXER_SIMD 1
+#endif
+#include "context.h"
+#include "sysy.tab.hpp"
+
+// 一个 token 在输入缓冲区中的位置
+struct Token {
+  // token 的种类, 和 next() 的返回值相同
+  int kind = 0;
+  // 在缓冲区中的偏移和长度
+  size_t offset = 0;
+  size_t len = 0;
+  // 所在的行号, 从 1 开始
+  int line = 1;
+};
+
+class FastLexer {
+  public:
+    FastLexer() = default;
+    FastLexer(const FastLexer &) = delete;
+    FastLexer &operator=(const FastLexer &) = delete;
+
+    ~FastLexer() {
+      if(mapped) {
+        munmap(const_cast<char *>(buf), size);
+      } else {
+        free(const_cast<char *>(buf));
+      }
+    }
+
+    // 打开输入文件, 失败时返回 false, 原因在 errno 中
+    // 普通文件用 mmap 映射, 不能映射的文件 (例如管道) 整个读进内存
+    bool open(const char *path) {
+      int fd = ::open(path, O_RDONLY);
+      if(fd < 0) {
+        return false;
+      }
+      struct stat st;
+      if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(p != MAP_FAILED) {
+          madvise(p, st.st_size, MADV_SEQUENTIAL);
+          buf = static_cast<const char *>(p);
+          size = st.st_size;
+          mapped = true;
+        }
+      }
+      bool ok = mapped || read_all(fd);
+      int err = errno;
+      ::close(fd);
+      errno = err;
+      return ok;
+    }
+
+    // 读取下一个 token, 返回它的种类, 输入结束时返回 0
+    // IDENT 和 INT_CONST 的值写进 lval, 和 sysy.l 中的规则相同
+    int next(YYSTYPE *lval) {
+      skip_space_and_comments();
+      tok.offset = pos;
+      tok.line = line;
+      if(pos >= size) {
+        tok.len = 0;
+        return tok.kind = 0;
+      }
+      unsigned char c = buf[pos];
+      if(is_ident_start(c)) {
+        size_t end = pos + 1;
+        while(end < size && is_ident_char(buf[end])) {
+          end ++;
+        }
+        tok.kind = keyword(buf + pos, end - pos);
+        if(tok.kind == IDENT) {
+          lval->sym_val = cur_ctx->interner.intern(buf + pos, end - pos);
+        }
+        return finish(end);
+      }
+      if(c >= '0' && c <= '9') {
+        return finish(lex_number(lval));
+      }
+      tok.kind = lex_operator();
+      return finish(pos + (tok.kind >= 256 ? 2 : 1));
+    }
+
+    // 最近一次 next() 读到的 token
+    const Token &token() const {
+      return tok;
+    }
+
+    // token 的文本, 直接指向输入缓冲区
+    std::string_view text(const Token &t) const {
+      return std::string_view(buf + t.offset, t.len);
+    }
+
+    // 当前的行号, 和 flex 的 yylineno 相同
+    int lineno() const {
+      return line;
+    }
+
+  private:
+    const char *buf = NULL;
+    size_t size = 0;
+    bool mapped = false;
+    // 下一个还没有读取的字节
+    size_t pos = 0;
+    int line = 1;
+    Token tok;
+
+    // 从 fd 读出全部内容, 放进 malloc 的缓冲区
+    bool read_all(int fd) {
+      size_t cap = 1 << 16;
+      char *data = static_cast<char *>(malloc(cap));
+      size_t len = 0;
+      while(data != NULL) {
+        if(len == cap) {
+          cap *= 2;
+          char *p = static_cast<char *>(realloc(data, cap));
+          if(p == NULL) {
+            break;
+          }
+          data = p;
+        }
+        ssize_t n = read(fd, data + len, cap - len);
+        if(n < 0) {
+          free(data);
+          return false;
+        }
+        if(n == 0) {
+          buf = data;
+          size = len;
+          return true;
+        }
+        len += n;
+      }
+      free(data);
+      throw std::bad_alloc();
+    }
+
+    int finish(size_t end) {
+      tok.len = end - pos;
+      pos = end;
+      return tok.kind;
+    }
+
+    static bool is_space(char c) {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    static bool is_ident_start(unsigned char c) {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    }
+
+    static bool is_ident_char(unsigned char c) {
+      return is_ident_start(c) || (c >= '0' && c <= '9');
+    }
+
+    // 关键字的完美哈希: (首字母 * 2 + 长度) % 4 把 int, return, const 映射到互不相同的位置
+    // 不是关键字时返回 IDENT
+    static int keyword(const char *str, size_t len) {
+      struct Keyword {
+        const char *text;
+        size_t len;
+        int kind;
+      };
+      static const Keyword table[4] = {
+        {"", 0, IDENT}, {"int", 3, INT}, {"return", 6, RETURN}, {"const", 5, CONST},
+      };
+      const Keyword &kw = table[((unsigned char)str[0] * 2 + len) % 4];
+      if(kw.len == len && memcmp(kw.text, str, len) == 0) {
+        return kw.kind;
+      }
+      return IDENT;
+    }
+
+    // 整数字面量, 返回结束位置; 规则和 sysy.l 相同:
+    // [1-9][0-9]* 是十进制, 0[xX] 后面至少有一位十六进制数字时是十六进制, 否则是 0[0-7]* 的八进制
+    size_t lex_number(YYSTYPE *lval) {
+      size_t end = pos + 1;
+      int base = 10;
+      if(buf[pos] == '0') {
+        base = 8;
+        if(end + 1 < size && (buf[end] == 'x' || buf[end] == 'X') && hex_digit(buf[end + 1]) >= 0) {
+          base = 16;
+          end ++;
+        }
+      }
+      size_t start = base == 16 ? end : pos;
+      while(end < size && hex_digit(buf[end]) >= 0 && hex_digit(buf[end]) < base) {
+        end ++;
+      }
+      // 和 strtol 一样, 溢出时结果是 LONG_MAX, 再截断成 int
+      long val = 0;
+      bool overflow = false;
+      for(size_t i = start; i < end && !overflow; i ++) {
+        overflow = __builtin_mul_overflow(val, base, &val) || __builtin_add_overflow(val, hex_digit(buf[i]), &val);
+      }
+      lval->int_val = overflow ? LONG_MAX : val;
+      tok.kind = INT_CONST;
+      return end;
+    }
+
+    static int hex_digit(char c) {
+      if(c >= '0' && c <= '9') {
+        return c - '0';
+      } else if(c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+      } else if(c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+      }
+      return -1;
+    }
+
+    // 双字符运算符返回对应的 token, 其他字符和 flex 的 . 规则一样返回字符本身 (char 是有符号的)
+    int lex_operator() const {
+      char c = buf[pos];
+      char d = pos + 1 < size ? buf[pos + 1] : 0;
+      switch(c) {
+        case '<':
+          return d == '=' ? EQUAL_OR_LESSER : c;
+        case '>':
+          return d == '=' ? EQUAL_OR_GREATER : c;
+        case '=':
+          return d == '=' ? EQUAL : c;
+        case '!':
+          return d == '=' ? NOT_EQUAL : c;
+        case '&':
+          return d == '&' ? AND : c;
+        case '|':
+          return d == '|' ? OR : c;
+        default:
+          return c;
+      }
+    }
+
+    // 跳过空白符和注释
+    // 行注释不包括结尾的换行符, 没有结束的块注释不是注释, 和 flex 一样把 / 当作普通字符
+    void skip_space_and_comments() {
+      while(true) {
+        skip_space();
+        if(pos + 1 >= size || buf[pos] != '/') {
+          return;
+        }
+        if(buf[pos + 1] == '/') {
+          pos = find_newline(pos + 2);
+        } else if(buf[pos + 1] != '*' || !skip_block_comment()) {
+          return;
+        }
+      }
+    }
+
+#ifdef FAST_LEXER_SIMD
+#ifdef __AVX2__
+    typedef __m256i Vec;
+    static const size_t WIDTH = 32;
+
+    static Vec load(const char *p) {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    }
+
+    // 每个等于 c 的字节对应结果中的一位
+    static uint32_t match(Vec v, char c) {
+      return _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)));
+    }
+#else
+    typedef __m128i Vec;
+    static const size_t WIDTH = 16;
+
+    static Vec load(const char *p) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    }
+
+    static uint32_t match(Vec v, char c) {
+      return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+    }
+#endif
+    // WIDTH 位都是 1 的掩码
+    static const uint32_t ALL_MASK = (uint32_t)((1ull << WIDTH) - 1);
+
+    // mask 中低于第 n 位的部分
+    static uint32_t below(uint32_t mask, int n) {
+      return mask & (uint32_t)((1ull << n) - 1);
+    }
+#endif
+
+    void skip_space() {
+      // token 之间通常只有一个空格, 先逐字节检查, 遇到连续的空白符 (缩进, 空行) 再按块处理
+      while(pos < size && is_space(buf[pos])) {
+        line += buf[pos] == '\n';
+        pos ++;
+        if(pos < size && !is_space(buf[pos])) {
+          return;
+        }
+#ifdef FAST_LEXER_SIMD
+        while(pos + WIDTH <= size) {
+          Vec v = load(buf + pos);
+          uint32_t newline = match(v, '\n');
+          uint32_t space = match(v, ' ') | match(v, '\t') | newline | match(v, '\r');
+          if(space != ALL_MASK) {
+            int n = __builtin_ctz(~space);
+            line += __builtin_popcount(below(newline, n));
+            pos += n;
+            return;
+          }
+          line += __builtin_popcount(newline);
+          pos += WIDTH;
+        }
+#endif
+      }
+    }
+
+    // 从 i 开始的第一个换行符的位置, 没有时返回 size
+    size_t find_newline(size_t i) const {
+#ifdef FAST_LEXER_SIMD
+      while(i + WIDTH <= size) {
+        uint32_t newline = match(load(buf + i), '\n');
+        if(newline != 0) {
+          return i + __builtin_ctz(newline);
+        }
+        i += WIDTH;
+      }
+#endif
+      while(i < size && buf[i] != '\n') {
+        i ++;
+      }
+      return i;
+    }
+
+    // 跳过 pos 处的块注释, 注释没有结束时返回 false, 不移动位置
+    // 只需要找第一个 */, 和 sysy.l 中的正则表达式匹配的范围相同
+    bool skip_block_comment() {
+      size_t i = pos + 2;
+      int lines = 0;
+#ifdef FAST_LEXER_SIMD
+      while(i + WIDTH <= size) {
+        Vec v = load(buf + i);
+        uint32_t star = match(v, '*');
+        uint32_t newline = match(v, '\n');
+        for(; star != 0; star &= star - 1) {
+          int n = __builtin_ctz(star);
+          if(i + n + 1 < size && buf[i + n + 1] == '/') {
+            line += lines + __builtin_popcount(below(newline, n));
+            pos = i + n + 2;
+            return true;
+          }
+        }
+        lines += __builtin_popcount(newline);
+        i += WIDTH;
+      }
+#endif
+      for(; i + 1 < size; i ++) {
+        if(buf[i] == '*' && buf[i + 1] == '/') {
+          line += lines;
+          pos = i + 2;
+          return true;
+        }
+        lines += buf[i] == '\n';
+      }
+      return false;
+    }
+};
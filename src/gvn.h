@@ -0,0 +1,221 @@
+// 全局值编号 (GVN): 删除重复计算的表达式和重复的 load
+// 在 SSA 形式上, 一个值的定义支配它的所有使用, 所以沿着支配树做带作用域的哈希值编号
+// (dominator-scoped value numbering): 先在支配者中计算过的同样的表达式可以直接复用,
+// 离开一个基本块的支配子树时, 它加入哈希表的表达式随之失效
+// load 只在基本块内部复用, 因为不同的路径上可能有不同的 store; mem2reg 提升了所有变量以后一般已经没有 load 了
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "cfg.h"
+#include "ir.h"
+
+class GVN {
+  public:
+    struct Stats {
+      // 被之前算过的值代替的运算
+      size_t exprs = 0;
+      // 被之前读到或写入的值代替的 load
+      size_t loads = 0;
+      // 操作数被替换以后可以常量折叠或化简的运算
+      size_t folded = 0;
+    };
+
+    void run(IRFunction &func) {
+      int n = func.insts.size();
+      int nbb = func.bbs.size();
+      CFG cfg = build_cfg(func);
+      repl.assign(n, IROperand{IROperand::NONE, 0});
+      known.assign(n, IROperand{IROperand::NONE, 0});
+      known_bb.assign(n, -1);
+      table.clear();
+
+      // 非递归地遍历支配树, added[b] 是基本块 b 加入哈希表的表达式
+      std::vector<bool> done(nbb);
+      std::vector<std::pair<int, size_t>> stack;
+      std::vector<std::vector<Expr>> added(nbb);
+      auto enter = [&](int b) {
+        done[b] = true;
+        visit(func, b, added[b]);
+        stack.emplace_back(b, 0);
+      };
+      for(int root = 0; root < nbb; root ++) {
+        // 不可达的基本块单独作为根, 不复用其他基本块中的值
+        if(done[root] || (root != 0 && cfg.reachable(root))) {
+          continue;
+        }
+        enter(root);
+        while(!stack.empty()) {
+          int b = stack.back().first;
+          size_t &next = stack.back().second;
+          if(cfg.reachable(b) && next < cfg.children[b].size()) {
+            enter(cfg.children[b][next ++]);
+            continue;
+          }
+          for(const Expr &expr : added[b]) {
+            table.erase(expr);
+          }
+          added[b].clear();
+          stack.pop_back();
+        }
+      }
+
+      // jump 的参数可以是循环中之后才访问到的基本块里的值, 不可达的基本块也可能用到之后才访问到的值,
+      // 所以最后再把所有操作数替换一遍
+      for(auto &bb : func.bbs) {
+        for(int id : bb.insts) {
+          IRInst &inst = func.insts[id];
+          switch(inst.tag) {
+            case IR_STORE:
+              resolve(inst.data.store.value);
+              break;
+            case IR_BINARY:
+              resolve(inst.data.binary.lhs);
+              resolve(inst.data.binary.rhs);
+              break;
+            case IR_BRANCH:
+              resolve(inst.data.branch.cond);
+              break;
+            case IR_RETURN:
+              resolve(inst.data.ret.value);
+              break;
+            default:
+              break;
+          }
+        }
+      }
+      for(auto &arg : func.jump_args) {
+        resolve(arg);
+      }
+    }
+
+    const Stats &stats() const {
+      return stats_;
+    }
+
+  private:
+    // 运算的 key: 运算符和两个操作数, 可交换的运算把操作数按固定的顺序排列
+    struct Expr {
+      int op;
+      IROperand lhs;
+      IROperand rhs;
+
+      bool operator==(const Expr &other) const {
+        return op == other.op && lhs.kind == other.lhs.kind && lhs.val == other.lhs.val &&
+               rhs.kind == other.rhs.kind && rhs.val == other.rhs.val;
+      }
+    };
+
+    struct ExprHash {
+      size_t operator()(const Expr &expr) const {
+        uint64_t h = (uint64_t)expr.op;
+        h = h * 0x9e3779b97f4a7c15ull + ((uint64_t)expr.lhs.kind << 32 | (uint32_t)expr.lhs.val);
+        h = h * 0x9e3779b97f4a7c15ull + ((uint64_t)expr.rhs.kind << 32 | (uint32_t)expr.rhs.val);
+        return h ^ (h >> 29);
+      }
+    };
+
+    Stats stats_;
+    // 被删除的指令的值被替换成的操作数, kind 为 NONE 表示没有被替换
+    std::vector<IROperand> repl;
+    // 当前基本块中每个 alloc 的已知值, 只在 known_bb 等于当前基本块时有效
+    std::vector<IROperand> known;
+    std::vector<int> known_bb;
+    // 当前基本块的支配者中已经计算过的运算
+    std::unordered_map<Expr, int, ExprHash> table;
+
+    void resolve(IROperand &opr) {
+      // 替换成的值本身不会再被替换, 所以只需要替换一次
+      if(opr.kind == IROperand::VALUE && repl[opr.val].kind != IROperand::NONE) {
+        opr = repl[opr.val];
+      }
+    }
+
+    static bool less(const IROperand &a, const IROperand &b) {
+      return a.kind != b.kind ? a.kind < b.kind : a.val < b.val;
+    }
+
+    // 规范化运算的 key: 可交换的运算让较小的操作数在左边, a > b 改写成 b < a, a >= b 改写成 b <= a
+    static Expr canonical(const IRBinary &binary) {
+      Expr expr{binary.op, binary.lhs, binary.rhs};
+      switch(binary.op) {
+        case IR_NOT_EQ: case IR_EQ: case IR_ADD: case IR_MUL: case IR_AND: case IR_OR:
+          if(less(expr.rhs, expr.lhs)) {
+            std::swap(expr.lhs, expr.rhs);
+          }
+          break;
+        case IR_GT:
+          expr.op = IR_LT;
+          std::swap(expr.lhs, expr.rhs);
+          break;
+        case IR_GE:
+          expr.op = IR_LE;
+          std::swap(expr.lhs, expr.rhs);
+          break;
+        default:
+          break;
+      }
+      return expr;
+    }
+
+    // 处理一个基本块: 替换操作数, 删除可以复用之前的值的运算和 load
+    void visit(IRFunction &func, int b, std::vector<Expr> &added) {
+      IRBasicBlock &bb = func.bbs[b];
+      std::vector<int> insts;
+      for(int id : bb.insts) {
+        IRInst &inst = func.insts[id];
+        switch(inst.tag) {
+          case IR_LOAD: {
+            int src = inst.data.load.src;
+            if(known_bb[src] == b) {
+              repl[id] = known[src];
+              stats_.loads ++;
+              continue;
+            }
+            known_bb[src] = b;
+            known[src] = ir_value(id);
+            break;
+          }
+          case IR_STORE:
+            resolve(inst.data.store.value);
+            known_bb[inst.data.store.dest] = b;
+            known[inst.data.store.dest] = inst.data.store.value;
+            break;
+          case IR_BINARY: {
+            IRBinary &binary = inst.data.binary;
+            resolve(binary.lhs);
+            resolve(binary.rhs);
+            IROperand res;
+            if(ir_fold(binary.op, binary.lhs, binary.rhs, res)) {
+              repl[id] = res;
+              stats_.folded ++;
+              continue;
+            }
+            Expr expr = canonical(binary);
+            auto it = table.find(expr);
+            if(it != table.end()) {
+              repl[id] = ir_value(it->second);
+              stats_.exprs ++;
+              continue;
+            }
+            table.emplace(expr, id);
+            added.push_back(expr);
+            break;
+          }
+          case IR_BRANCH:
+            resolve(inst.data.branch.cond);
+            break;
+          case IR_RETURN:
+            resolve(inst.data.ret.value);
+            break;
+          default:
+            break;
+        }
+        insts.push_back(id);
+      }
+      bb.insts = std::move(insts);
+    }
+};
@@ -0,0 +1,39 @@
+// 字符串驻留表
+// lexer 把每个标识符映射成一个整数编号, 之后前端都用编号代替字符串
+#pragma once
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+class Interner {
+  public:
+    // 返回字符串对应的编号, 第一次出现时分配新的编号
+    int intern(const char *str, size_t len) {
+      std::string_view key(str, len);
+      auto it = ids.find(key);
+      if(it != ids.end()) {
+        return it->second;
+      }
+      names.emplace_back(key);
+      int id = names.size() - 1;
+      ids.emplace(names.back(), id);
+      return id;
+    }
+
+    // 编号对应的字符串
+    const std::string &name(int id) const {
+      return names[id];
+    }
+
+    // 已经分配的编号个数
+    int size() const {
+      return names.size();
+    }
+
+  private:
+    // ids 中的 key 指向 names 中的字符串, deque 保证追加元素时已有元素不会移动
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, int> ids;
+};
@@ -0,0 +1,514 @@
+// 内存中的 IR 表示
+// 结构与 Koopa IR 的 raw program 基本一致, 前端直接生成这种结构, 后端直接访问它,
+// 不再需要把 Koopa IR 文本写到文件里再读回来解析
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "emitter.h"
+
+// 指令种类
+enum IRInstTag {
+  IR_ALLOC,
+  IR_LOAD,
+  IR_STORE,
+  IR_BINARY,
+  IR_BRANCH,
+  IR_JUMP,
+  IR_RETURN,
+  // 基本块参数, 不出现在基本块的指令列表中, 而是在 IRBasicBlock::params 中
+  IR_BLOCK_ARG,
+};
+
+// 二元运算符, 与 Koopa IR 中的 binary op 一一对应
+enum IRBinaryOp {
+  IR_NOT_EQ,
+  IR_EQ,
+  IR_GT,
+  IR_LT,
+  IR_GE,
+  IR_LE,
+  IR_ADD,
+  IR_SUB,
+  IR_MUL,
+  IR_DIV,
+  IR_MOD,
+  IR_AND,
+  IR_OR,
+};
+
+// 操作数: 整数常量, 或者某条指令的结果 (用指令在函数中的编号表示)
+struct IROperand {
+  enum Kind { NONE, INTEGER, VALUE } kind;
+  int val;
+};
+
+struct IRAlloc {
+  // 变量名在函数名字表中的下标
+  int name;
+};
+
+struct IRLoad {
+  // 被读取的 alloc 的编号
+  int src;
+};
+
+struct IRStore {
+  IROperand value;
+  // 被写入的 alloc 的编号
+  int dest;
+};
+
+struct IRBinary {
+  IRBinaryOp op;
+  IROperand lhs;
+  IROperand rhs;
+};
+
+struct IRBranch {
+  IROperand cond;
+  // 条件成立/不成立时跳转到的基本块的下标
+  int true_bb;
+  int false_bb;
+};
+
+struct IRJump {
+  // 跳转到的基本块的下标
+  int target;
+  // 传给目标基本块的参数是 IRFunction::jump_args 中从 args 开始的 arg_num 个
+  int args;
+  int arg_num;
+};
+
+struct IRReturn {
+  IROperand value;
+};
+
+// 指令, 和 koopa_raw_value_kind_t 一样用 tag + union 表示
+struct IRInst {
+  IRInstTag tag;
+  union {
+    IRAlloc alloc;
+    IRLoad load;
+    IRStore store;
+    IRBinary binary;
+    IRBranch branch;
+    IRJump jump;
+    IRReturn ret;
+  } data;
+};
+
+struct IRBasicBlock {
+  std::string name;
+  // 基本块参数 (IR_BLOCK_ARG 指令) 的编号, 相当于 phi
+  std::vector<int> params;
+  // 基本块中的指令, 保存的是指令在函数中的编号
+  std::vector<int> insts;
+};
+
+struct IRFunction {
+  std::string name;
+  // 函数中的所有指令, 指令的编号就是它在这里的下标
+  std::vector<IRInst> insts;
+  std::vector<IRBasicBlock> bbs;
+  // alloc 的变量名
+  std::vector<std::string> names;
+  // 所有 jump 指令传递的参数
+  std::vector<IROperand> jump_args;
+};
+
+struct IRProgram {
+  std::vector<IRFunction> funcs;
+};
+
+// 指令是否有返回值 (即 Koopa IR 中类型不是 unit 的指令)
+inline bool ir_has_value(const IRInst &inst) {
+  return inst.tag == IR_ALLOC || inst.tag == IR_LOAD || inst.tag == IR_BINARY || inst.tag == IR_BLOCK_ARG;
+}
+
+// 指令是否是基本块的结尾 (br/jump/ret)
+inline bool ir_is_terminator(const IRInst &inst) {
+  return inst.tag == IR_BRANCH || inst.tag == IR_JUMP || inst.tag == IR_RETURN;
+}
+
+// 对函数 func 中的指令 inst 用到的每个值调用 f
+template<typename F>
+void for_each_use(const IRFunction &func, const IRInst &inst, F f) {
+  auto use = [&](const IROperand &opr) {
+    if(opr.kind == IROperand::VALUE) {
+      f(opr.val);
+    }
+  };
+  switch(inst.tag) {
+    case IR_STORE:
+      use(inst.data.store.value);
+      break;
+    case IR_BINARY:
+      use(inst.data.binary.lhs);
+      use(inst.data.binary.rhs);
+      break;
+    case IR_BRANCH:
+      use(inst.data.branch.cond);
+      break;
+    case IR_JUMP:
+      for(int i = 0; i < inst.data.jump.arg_num; i ++) {
+        use(func.jump_args[inst.data.jump.args + i]);
+      }
+      break;
+    case IR_RETURN:
+      use(inst.data.ret.value);
+      break;
+    default:
+      break;
+  }
+}
+
+// 没有值的操作数, 例如不是表达式的 AST 节点的 Dump() 结果
+inline IROperand ir_none() {
+  return IROperand{IROperand::NONE, 0};
+}
+
+inline IROperand ir_integer(int val) {
+  return IROperand{IROperand::INTEGER, val};
+}
+
+inline IROperand ir_value(int id) {
+  return IROperand{IROperand::VALUE, id};
+}
+
+// 计算常量二元运算, 结果和 RISC-V 上运行时的结果一致 (加减乘按 32 位回绕)
+// 除以 0 和 INT_MIN / -1 在运行时才会出错, 这时返回 false, 保留原来的指令
+inline bool ir_eval(IRBinaryOp op, int lhs, int rhs, int &res) {
+  unsigned int l = lhs, r = rhs;
+  switch(op) {
+    case IR_NOT_EQ: res = lhs != rhs; return true;
+    case IR_EQ: res = lhs == rhs; return true;
+    case IR_GT: res = lhs > rhs; return true;
+    case IR_LT: res = lhs < rhs; return true;
+    case IR_GE: res = lhs >= rhs; return true;
+    case IR_LE: res = lhs <= rhs; return true;
+    case IR_ADD: res = (int)(l + r); return true;
+    case IR_SUB: res = (int)(l - r); return true;
+    case IR_MUL: res = (int)(l * r); return true;
+    case IR_AND: res = lhs & rhs; return true;
+    case IR_OR: res = lhs | rhs; return true;
+    case IR_DIV:
+    case IR_MOD:
+      if(rhs == 0 || (lhs == INT_MIN && rhs == -1)) {
+        return false;
+      }
+      res = op == IR_DIV ? lhs / rhs : lhs % rhs;
+      return true;
+  }
+  return false;
+}
+
+// 常量折叠和代数化简: 两个操作数都是常量时直接求值, 另外处理
+// x+0, x-0, x*1, x/1, x*0, x%1, x-x 以及 x 和自己比较这些不需要知道 x 的值的情况
+// 能化简时把结果写进 res 并返回 true; 所有的值都没有副作用, 所以丢掉 x 是安全的
+inline bool ir_fold(IRBinaryOp op, IROperand lhs, IROperand rhs, IROperand &res) {
+  bool l_int = lhs.kind == IROperand::INTEGER, r_int = rhs.kind == IROperand::INTEGER;
+  if(l_int && r_int) {
+    int val;
+    if(!ir_eval(op, lhs.val, rhs.val, val)) {
+      return false;
+    }
+    res = ir_integer(val);
+    return true;
+  }
+  // 单位元
+  if(r_int && ((rhs.val == 0 && (op == IR_ADD || op == IR_SUB)) ||
+               (rhs.val == 1 && (op == IR_MUL || op == IR_DIV)))) {
+    res = lhs;
+    return true;
+  }
+  if(l_int && ((lhs.val == 0 && op == IR_ADD) || (lhs.val == 1 && op == IR_MUL))) {
+    res = rhs;
+    return true;
+  }
+  // 零元
+  if((op == IR_MUL && ((l_int && lhs.val == 0) || (r_int && rhs.val == 0))) ||
+     (op == IR_MOD && r_int && (rhs.val == 1 || rhs.val == -1))) {
+    res = ir_integer(0);
+    return true;
+  }
+  // 同一个值的运算
+  if(!l_int && !r_int && lhs.val == rhs.val) {
+    switch(op) {
+      case IR_SUB: case IR_NOT_EQ: case IR_GT: case IR_LT:
+        res = ir_integer(0);
+        return true;
+      case IR_EQ: case IR_GE: case IR_LE:
+        res = ir_integer(1);
+        return true;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+// 生成 IR 的辅助类, 新指令总是被追加到当前函数的最后一个基本块中
+// 最后一个基本块已经以 br/jump/ret 结尾时, 之后的指令放进一个新的 (不可达的) 基本块
+class IRBuilder {
+  public:
+    IRProgram program;
+
+    // 生成 IR 时的统计信息
+    struct Stats {
+      // 被常量折叠和代数化简省掉的指令数
+      size_t folded = 0;
+    };
+
+    void new_function(const std::string &name) {
+      program.funcs.emplace_back();
+      program.funcs.back().name = name;
+      label_count = 0;
+    }
+
+    // 函数结束时, 如果最后一个基本块没有以 br/jump/ret 结尾, 补上 ret 0
+    void end_function() {
+      if(!terminated()) {
+        ret(ir_integer(0));
+      }
+    }
+
+    // 新建一个基本块作为当前基本块, 返回它的下标
+    int new_block(const std::string &name) {
+      cur_func().bbs.emplace_back();
+      cur_func().bbs.back().name = name;
+      return cur_func().bbs.size() - 1;
+    }
+
+    // 当前基本块的下标
+    int cur_block() {
+      return cur_func().bbs.size() - 1;
+    }
+
+    // 返回一个在当前函数中唯一的编号, 用来生成基本块和临时变量的名字
+    int new_label() {
+      return label_count ++;
+    }
+
+    int alloc(const std::string &name) {
+      IRInst inst;
+      inst.tag = IR_ALLOC;
+      inst.data.alloc.name = cur_func().names.size();
+      cur_func().names.push_back(name);
+      return append(inst);
+    }
+
+    int load(int src) {
+      IRInst inst;
+      inst.tag = IR_LOAD;
+      inst.data.load.src = src;
+      return append(inst);
+    }
+
+    void store(IROperand value, int dest) {
+      IRInst inst;
+      inst.tag = IR_STORE;
+      inst.data.store.value = value;
+      inst.data.store.dest = dest;
+      append(inst);
+    }
+
+    // 返回运算的结果, 能在编译时化简的运算不生成指令
+    IROperand binary(IRBinaryOp op, IROperand lhs, IROperand rhs) {
+      IROperand res;
+      if(ir_fold(op, lhs, rhs, res)) {
+        stats_.folded ++;
+        return res;
+      }
+      IRInst inst;
+      inst.tag = IR_BINARY;
+      inst.data.binary.op = op;
+      inst.data.binary.lhs = lhs;
+      inst.data.binary.rhs = rhs;
+      return ir_value(append(inst));
+    }
+
+    // 返回 br 指令的编号, 跳转目标还没有建立时可以之后再通过 inst() 填写
+    int branch(IROperand cond, int true_bb, int false_bb) {
+      IRInst inst;
+      inst.tag = IR_BRANCH;
+      inst.data.branch.cond = cond;
+      inst.data.branch.true_bb = true_bb;
+      inst.data.branch.false_bb = false_bb;
+      return append(inst);
+    }
+
+    int jump(int target) {
+      IRInst inst;
+      inst.tag = IR_JUMP;
+      inst.data.jump.target = target;
+      inst.data.jump.args = 0;
+      inst.data.jump.arg_num = 0;
+      return append(inst);
+    }
+
+    void ret(IROperand value) {
+      IRInst inst;
+      inst.tag = IR_RETURN;
+      inst.data.ret.value = value;
+      append(inst);
+    }
+
+    IRInst &inst(int id) {
+      return cur_func().insts[id];
+    }
+
+    // 操作数的值是否一定是 0 或 1 (比较运算, 以及 0/1 之间的与/或)
+    bool is_bool(IROperand opr) {
+      if(opr.kind == IROperand::INTEGER) {
+        return opr.val == 0 || opr.val == 1;
+      }
+      const IRInst &def = cur_func().insts[opr.val];
+      return def.tag == IR_BINARY && (def.data.binary.op <= IR_LE || def.data.binary.op >= IR_AND);
+    }
+
+    const Stats &stats() const {
+      return stats_;
+    }
+
+  private:
+    Stats stats_;
+    // 当前函数中已经用掉的编号个数
+    int label_count = 0;
+
+    bool terminated() {
+      const auto &insts = cur_func().bbs.back().insts;
+      return !insts.empty() && ir_is_terminator(cur_func().insts[insts.back()]);
+    }
+
+    IRFunction &cur_func() {
+      return program.funcs.back();
+    }
+
+    int append(const IRInst &inst) {
+      if(terminated()) {
+        new_block("unreachable_" + std::to_string(new_label()));
+      }
+      IRFunction &func = cur_func();
+      func.insts.push_back(inst);
+      func.bbs.back().insts.push_back(func.insts.size() - 1);
+      return func.insts.size() - 1;
+    }
+};
+
+/* 输出 Koopa IR 文本 */
+
+static const char *ir_binary_name[] = {
+  "ne", "eq", "gt", "lt", "ge", "le", "add", "sub", "mul", "div", "mod", "and", "or",
+};
+
+// 输出操作数, tmp[i] 是指令 i 的结果在函数内的临时变量编号
+inline void DumpOperand(const IRFunction &func, const std::vector<int> &tmp, IROperand opr, Emitter &out) {
+  if(opr.kind == IROperand::INTEGER) {
+    out << opr.val;
+    return;
+  }
+  const IRInst &inst = func.insts[opr.val];
+  if(inst.tag == IR_ALLOC) {
+    out << '@' << func.names[inst.data.alloc.name];
+  } else {
+    out << '%' << tmp[opr.val];
+  }
+}
+
+// 函数内的临时变量按出现顺序重新编号为 %0, %1, ...
+inline void DumpKoopa(const IRFunction &func, Emitter &out) {
+  std::vector<int> tmp(func.insts.size(), -1);
+  int now = 0;
+  for(const auto &bb : func.bbs) {
+    for(int id : bb.params) {
+      tmp[id] = now ++;
+    }
+    for(int id : bb.insts) {
+      if(ir_has_value(func.insts[id]) && func.insts[id].tag != IR_ALLOC) {
+        tmp[id] = now ++;
+      }
+    }
+  }
+  out << "fun @" << func.name << "(): i32 {\n";
+  for(const auto &bb : func.bbs) {
+    out << '%' << bb.name;
+    if(!bb.params.empty()) {
+      out << '(';
+      for(size_t i = 0; i < bb.params.size(); i ++) {
+        out << (i > 0 ? ", %" : "%") << tmp[bb.params[i]] << ": i32";
+      }
+      out << ')';
+    }
+    out << ":\n";
+    for(int id : bb.insts) {
+      const IRInst &inst = func.insts[id];
+      switch(inst.tag) {
+        case IR_ALLOC:
+          out << "  ";
+          DumpOperand(func, tmp, ir_value(id), out);
+          out << " = alloc i32\n";
+          break;
+        case IR_LOAD:
+          out << "  %" << tmp[id] << " = load ";
+          DumpOperand(func, tmp, ir_value(inst.data.load.src), out);
+          out << '\n';
+          break;
+        case IR_STORE:
+          out << "  store ";
+          DumpOperand(func, tmp, inst.data.store.value, out);
+          out << ", ";
+          DumpOperand(func, tmp, ir_value(inst.data.store.dest), out);
+          out << '\n';
+          break;
+        case IR_BINARY:
+          out << "  %" << tmp[id] << " = " << ir_binary_name[inst.data.binary.op] << ' ';
+          DumpOperand(func, tmp, inst.data.binary.lhs, out);
+          out << ", ";
+          DumpOperand(func, tmp, inst.data.binary.rhs, out);
+          out << '\n';
+          break;
+        case IR_BRANCH:
+          out << "  br ";
+          DumpOperand(func, tmp, inst.data.branch.cond, out);
+          out << ", %" << func.bbs[inst.data.branch.true_bb].name;
+          out << ", %" << func.bbs[inst.data.branch.false_bb].name << '\n';
+          break;
+        case IR_JUMP:
+          out << "  jump %" << func.bbs[inst.data.jump.target].name;
+          if(inst.data.jump.arg_num > 0) {
+            out << '(';
+            for(int i = 0; i < inst.data.jump.arg_num; i ++) {
+              if(i > 0) {
+                out << ", ";
+              }
+              DumpOperand(func, tmp, func.jump_args[inst.data.jump.args + i], out);
+            }
+            out << ')';
+          }
+          out << '\n';
+          break;
+        case IR_RETURN:
+          out << "  ret ";
+          DumpOperand(func, tmp, inst.data.ret.value, out);
+          out << '\n';
+          break;
+        default:
+          break;
+      }
+    }
+  }
+  out << "}\n";
+}
+
+inline void DumpKoopa(const IRProgram &program, Emitter &out) {
+  for(size_t i = 0; i < program.funcs.size(); i ++) {
+    // 函数之间空一行
+    if(i > 0) {
+      out << '\n';
+    }
+    DumpKoopa(program.funcs[i], out);
+  }
+}
@@ -0,0 +1,637 @@
+// 二进制格式的 IR
+// -ir 模式把 mem2reg, GVN 和 DCE 之后的 IR 写成这种格式; -koopa/-riscv 的输入文件以 "SYIR" 开头时直接读取它,
+// 不再经过 lexer, parser 和 IR 生成, 这样前端和后端可以放在流水线的不同阶段, 中间不需要解析文本
+//
+// 文件结构, 整数都按小端序保存, 每一部分都按 4 字节对齐:
+//   文件头     "SYIR", u32 版本号, u64 函数目录在文件中的偏移
+//   函数       每个函数一段, 互不引用, 所以可以只读取其中一个函数
+//   函数目录   u32 函数个数, 然后是每个函数的 u64 偏移和 u64 长度
+// 每个函数的结构:
+//   IRFuncHeader  各部分的长度
+//   指令          每条指令一个定长的 IRInstRecord, 指令的编号就是下标, 按基本块中出现的顺序编号
+//   基本块        每个基本块一个 IRBlockRecord
+//   下标          每个基本块的参数和指令的编号 (i32), 按基本块的顺序排列
+//   变量名        每个 alloc 的变量名在字符串表中的编号 (u32)
+//   jump 参数     每个参数一个 IROperandRecord
+//   字符串表      每个字符串的 u32 偏移和 u32 长度, 然后是所有字符串的内容; 0 号字符串是函数名
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+#include "emitter.h"
+#include "ir.h"
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "binary IR is stored in host byte order");
+
+// 文件开头的 4 个字节
+static const char IR_BINARY_MAGIC[4] = {'S', 'Y', 'I', 'R'};
+// 格式变化时修改版本号, 旧版本的文件不能再读取
+static const uint32_t IR_BINARY_VERSION = 1;
+
+struct IRFileHeader {
+  char magic[4];
+  uint32_t version;
+  // 函数目录在文件中的偏移
+  uint64_t directory;
+};
+
+struct IRFuncHeader {
+  uint32_t insts;
+  uint32_t bbs;
+  uint32_t names;
+  uint32_t jump_args;
+  // 所有基本块的参数和指令的总数
+  uint32_t indices;
+  uint32_t strings;
+  // 字符串内容的总字节数, 不包括补齐的部分
+  uint32_t string_bytes;
+};
+
+// 一条指令, 各种指令的字段依次放进 a, b, c, d:
+//   alloc: a = 变量名       load: a = src            store: kind[0]/a = value, b = dest
+//   binary: op, kind[0]/a = lhs, kind[1]/b = rhs     branch: kind[0]/a = cond, b = true_bb, c = false_bb
+//   jump: a = target, b = args, c = arg_num          return: kind[0]/a = value
+struct IRInstRecord {
+  uint8_t tag;
+  uint8_t op;
+  uint8_t kind[2];
+  int32_t a, b, c, d;
+};
+
+struct IRBlockRecord {
+  // 名字在字符串表中的编号
+  uint32_t name;
+  uint32_t params;
+  uint32_t insts;
+};
+
+struct IROperandRecord {
+  int32_t kind;
+  int32_t val;
+};
+
+// 把 IR 写成二进制格式
+class IRWriter {
+  public:
+    // 文件头, 函数目录的偏移在 finish 时才知道, 先留空
+    static void write_header(Emitter &out) {
+      IRFileHeader header;
+      memcpy(header.magic, IR_BINARY_MAGIC, 4);
+      header.version = IR_BINARY_VERSION;
+      header.directory = 0;
+      write(out, header);
+    }
+
+    // 把一个函数追加到 out
+    // mem2reg, GVN 和 DCE 删掉的指令还留在 func.insts 中, 这里只写基本块中的指令和它们引用的指令, 并且按基本块的顺序重新编号
+    static void write_function(const IRFunction &func, Emitter &out) {
+      // remap[i] 是 i 号指令的新编号, order 是按新编号排列的旧编号
+      std::vector<int> remap(func.insts.size(), -1);
+      std::vector<int> order;
+      auto renumber = [&](int id) {
+        if(remap[id] < 0) {
+          remap[id] = order.size();
+          order.push_back(id);
+        }
+        return remap[id];
+      };
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.params) {
+          renumber(id);
+        }
+        for(int id : bb.insts) {
+          renumber(id);
+        }
+      }
+      // mem2reg 和 DCE 原地去掉 jump 上没用的参数, DCE 还会删掉整个基本块和其中的 jump,
+      // 剩下的不再被任何 jump 使用的位置可能引用被删掉的指令, 写成 NONE
+      std::vector<bool> used(func.jump_args.size());
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.insts) {
+          const IRInst &inst = func.insts[id];
+          if(inst.tag == IR_JUMP) {
+            for(int i = 0; i < inst.data.jump.arg_num; i ++) {
+              used[inst.data.jump.args + i] = true;
+            }
+          }
+        }
+      }
+      std::vector<IROperandRecord> jump_args;
+      for(size_t i = 0; i < func.jump_args.size(); i ++) {
+        const IROperand &arg = func.jump_args[i];
+        if(!used[i]) {
+          jump_args.push_back(IROperandRecord{IROperand::NONE, 0});
+        } else {
+          jump_args.push_back(IROperandRecord{arg.kind, arg.kind == IROperand::VALUE ? renumber(arg.val) : arg.val});
+        }
+      }
+      // 编码时遇到的新的指令会追加到 order 的末尾, 所以不能用范围 for
+      std::vector<IRInstRecord> insts;
+      for(size_t i = 0; i < order.size(); i ++) {
+        insts.push_back(encode(func.insts[order[i]], renumber));
+      }
+
+      StringTable strings;
+      strings.add(func.name);
+      IRFuncHeader header;
+      header.insts = insts.size();
+      header.bbs = func.bbs.size();
+      header.names = func.names.size();
+      header.jump_args = func.jump_args.size();
+      header.indices = 0;
+      for(const auto &bb : func.bbs) {
+        header.indices += bb.params.size() + bb.insts.size();
+      }
+      std::vector<uint32_t> names;
+      for(const auto &name : func.names) {
+        names.push_back(strings.add(name));
+      }
+      std::vector<IRBlockRecord> bbs;
+      for(const auto &bb : func.bbs) {
+        bbs.push_back(IRBlockRecord{strings.add(bb.name), (uint32_t)bb.params.size(), (uint32_t)bb.insts.size()});
+      }
+      header.strings = strings.list.size();
+      header.string_bytes = strings.bytes;
+      write(out, header);
+
+      write_array(out, insts.data(), insts.size());
+      write_array(out, bbs.data(), bbs.size());
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.params) {
+          write(out, (int32_t)remap[id]);
+        }
+        for(int id : bb.insts) {
+          write(out, (int32_t)remap[id]);
+        }
+      }
+      write_array(out, names.data(), names.size());
+      write_array(out, jump_args.data(), jump_args.size());
+      uint32_t offset = 0;
+      for(auto str : strings.list) {
+        uint32_t range[2] = {offset, (uint32_t)str.size()};
+        write(out, range);
+        offset += str.size();
+      }
+      for(auto str : strings.list) {
+        out << str;
+      }
+      for(size_t i = strings.bytes; i % 4 != 0; i ++) {
+        out << '\0';
+      }
+    }
+
+    // 把函数目录追加到 out, offsets 是每个函数在文件中的偏移, 最后一项是函数目录自己的偏移
+    // 函数目录的偏移还要由调用者写回文件头的 directory 字段 (DIRECTORY_FIELD)
+    static void write_directory(const std::vector<uint64_t> &offsets, Emitter &out) {
+      uint32_t count = offsets.size() - 1;
+      write(out, count);
+      for(uint32_t i = 0; i < count; i ++) {
+        uint64_t entry[2] = {offsets[i], offsets[i + 1] - offsets[i]};
+        write(out, entry);
+      }
+    }
+
+    // IRFileHeader::directory 在文件中的偏移
+    static const size_t DIRECTORY_FIELD = offsetof(IRFileHeader, directory);
+
+  private:
+    // 函数内的字符串表, 相同的字符串只保存一次
+    struct StringTable {
+      std::vector<std::string_view> list;
+      std::unordered_map<std::string_view, uint32_t> ids;
+      size_t bytes = 0;
+
+      uint32_t add(std::string_view str) {
+        auto it = ids.find(str);
+        if(it != ids.end()) {
+          return it->second;
+        }
+        uint32_t id = list.size();
+        list.push_back(str);
+        ids.emplace(str, id);
+        bytes += str.size();
+        return id;
+      }
+    };
+
+    template<typename T>
+    static void write(Emitter &out, const T &val) {
+      out << std::string_view(reinterpret_cast<const char *>(&val), sizeof(val));
+    }
+
+    template<typename T>
+    static void write_array(Emitter &out, const T *data, size_t n) {
+      // 空数组的 data() 可以是 NULL
+      if(n == 0) {
+        return;
+      }
+      out << std::string_view(reinterpret_cast<const char *>(data), sizeof(T) * n);
+    }
+
+    // 编码一条指令, 引用的指令编号用 renumber 换成新的编号
+    template<typename F>
+    static IRInstRecord encode(const IRInst &inst, F &renumber) {
+      auto value = [&](const IROperand &opr) {
+        return opr.kind == IROperand::VALUE ? renumber(opr.val) : opr.val;
+      };
+      IRInstRecord rec;
+      memset(&rec, 0, sizeof(rec));
+      rec.tag = inst.tag;
+      switch(inst.tag) {
+        case IR_ALLOC:
+          rec.a = inst.data.alloc.name;
+          break;
+        case IR_LOAD:
+          rec.a = renumber(inst.data.load.src);
+          break;
+        case IR_STORE:
+          rec.kind[0] = inst.data.store.value.kind;
+          rec.a = value(inst.data.store.value);
+          rec.b = renumber(inst.data.store.dest);
+          break;
+        case IR_BINARY:
+          rec.op = inst.data.binary.op;
+          rec.kind[0] = inst.data.binary.lhs.kind;
+          rec.a = value(inst.data.binary.lhs);
+          rec.kind[1] = inst.data.binary.rhs.kind;
+          rec.b = value(inst.data.binary.rhs);
+          break;
+        case IR_BRANCH:
+          rec.kind[0] = inst.data.branch.cond.kind;
+          rec.a = value(inst.data.branch.cond);
+          rec.b = inst.data.branch.true_bb;
+          rec.c = inst.data.branch.false_bb;
+          break;
+        case IR_JUMP:
+          rec.a = inst.data.jump.target;
+          rec.b = inst.data.jump.args;
+          rec.c = inst.data.jump.arg_num;
+          break;
+        case IR_RETURN:
+          rec.kind[0] = inst.data.ret.value.kind;
+          rec.a = value(inst.data.ret.value);
+          break;
+        case IR_BLOCK_ARG:
+          break;
+      }
+      return rec;
+    }
+};
+
+// 读取二进制格式的 IR
+// 文件用 mmap 映射进内存, 打开时只读函数目录, 每个函数在 load 时才解码
+class IRReader {
+  public:
+    IRReader() = default;
+    IRReader(const IRReader &) = delete;
+    IRReader &operator=(const IRReader &) = delete;
+
+    ~IRReader() {
+      if(data != NULL) {
+        munmap(const_cast<char *>(data), size);
+      }
+    }
+
+    // 文件是否以二进制 IR 的 magic 开头
+    static bool is_binary_ir(const char *path) {
+      int fd = ::open(path, O_RDONLY);
+      if(fd < 0) {
+        return false;
+      }
+      char magic[4];
+      bool res = ::read(fd, magic, 4) == 4 && memcmp(magic, IR_BINARY_MAGIC, 4) == 0;
+      close(fd);
+      return res;
+    }
+
+    // 打开文件并读取函数目录, 文件不能读取或者格式不对时返回 false, error 是原因
+    bool open(const char *path) {
+      int fd = ::open(path, O_RDONLY);
+      if(fd < 0) {
+        error = strerror(errno);
+        return false;
+      }
+      struct stat st;
+      if(fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(IRFileHeader)) {
+        void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(p != MAP_FAILED) {
+          data = static_cast<const char *>(p);
+          size = st.st_size;
+        }
+      }
+      close(fd);
+      if(data == NULL) {
+        error = "not a binary IR file";
+        return false;
+      }
+      IRFileHeader header;
+      memcpy(&header, data, sizeof(header));
+      if(memcmp(header.magic, IR_BINARY_MAGIC, 4) != 0) {
+        error = "not a binary IR file";
+        return false;
+      }
+      if(header.version != IR_BINARY_VERSION) {
+        error = "unsupported binary IR version " + std::to_string(header.version);
+        return false;
+      }
+      uint32_t count;
+      if(header.directory > size - 4 || !read(header.directory, count) ||
+         count > (size - header.directory - 4) / 16) {
+        error = "corrupted function directory";
+        return false;
+      }
+      for(uint32_t i = 0; i < count; i ++) {
+        uint64_t entry[2];
+        read(header.directory + 4 + i * 16, entry);
+        if(entry[0] > size || entry[1] > size - entry[0]) {
+          error = "corrupted function directory";
+          return false;
+        }
+        funcs.push_back(Range{entry[0], entry[1]});
+      }
+      return true;
+    }
+
+    // 函数个数
+    size_t func_num() const {
+      return funcs.size();
+    }
+
+    // 解码第 i 个函数, 放进 func (func 原来的内容被覆盖, 已经分配的空间可以复用); 数据损坏时返回 false
+    bool load(size_t i, IRFunction &func) {
+      Cursor cur{data + funcs[i].offset, data + funcs[i].offset + funcs[i].size};
+      IRFuncHeader header;
+      if(!cur.read(header)) {
+        return corrupted(i);
+      }
+      // 各部分的长度不能超过函数本身的长度, 否则不能按这些长度分配内存
+      uint64_t bytes = (uint64_t)header.insts * sizeof(IRInstRecord) + (uint64_t)header.bbs * sizeof(IRBlockRecord) +
+                       ((uint64_t)header.indices + header.names) * 4 +
+                       (uint64_t)header.jump_args * sizeof(IROperandRecord) + (uint64_t)header.strings * 8;
+      if(bytes > (size_t)(cur.end - cur.p)) {
+        return corrupted(i);
+      }
+      func.insts.resize(header.insts);
+      for(auto &inst : func.insts) {
+        IRInstRecord rec;
+        if(!cur.read(rec) || !decode(rec, inst)) {
+          return corrupted(i);
+        }
+      }
+      std::vector<IRBlockRecord> bbs(header.bbs);
+      std::vector<uint32_t> names(header.names);
+      if(!cur.read_array(bbs.data(), bbs.size())) {
+        return corrupted(i);
+      }
+      func.bbs.resize(header.bbs);
+      uint64_t indices = 0;
+      for(size_t k = 0; k < bbs.size(); k ++) {
+        indices += bbs[k].params + bbs[k].insts;
+        if(indices > header.indices) {
+          return corrupted(i);
+        }
+        func.bbs[k].params.resize(bbs[k].params);
+        func.bbs[k].insts.resize(bbs[k].insts);
+        if(!cur.read_array(func.bbs[k].params.data(), bbs[k].params) ||
+           !cur.read_array(func.bbs[k].insts.data(), bbs[k].insts)) {
+          return corrupted(i);
+        }
+      }
+      func.jump_args.resize(header.jump_args);
+      if(!cur.read_array(names.data(), names.size())) {
+        return corrupted(i);
+      }
+      for(auto &arg : func.jump_args) {
+        IROperandRecord rec;
+        if(!cur.read(rec) || rec.kind < IROperand::NONE || rec.kind > IROperand::VALUE) {
+          return corrupted(i);
+        }
+        arg.kind = (IROperand::Kind)rec.kind;
+        arg.val = rec.val;
+      }
+
+      // 字符串表
+      std::vector<uint32_t> ranges(header.strings * 2);
+      if(header.strings == 0 || !cur.read_array(ranges.data(), ranges.size()) ||
+         (size_t)(cur.end - cur.p) < header.string_bytes) {
+        return corrupted(i);
+      }
+      const char *base = cur.p;
+      auto string = [&](uint32_t id, std::string &res) {
+        if(id >= header.strings || ranges[id * 2] > header.string_bytes ||
+           ranges[id * 2 + 1] > header.string_bytes - ranges[id * 2]) {
+          return false;
+        }
+        res.assign(base + ranges[id * 2], ranges[id * 2 + 1]);
+        return true;
+      };
+      if(!string(0, func.name)) {
+        return corrupted(i);
+      }
+      for(size_t k = 0; k < bbs.size(); k ++) {
+        if(!string(bbs[k].name, func.bbs[k].name)) {
+          return corrupted(i);
+        }
+      }
+      func.names.resize(names.size());
+      for(size_t k = 0; k < names.size(); k ++) {
+        if(!string(names[k], func.names[k])) {
+          return corrupted(i);
+        }
+      }
+      return check(func) || corrupted(i);
+    }
+
+    // 最近一次出错的原因
+    const std::string &last_error() const {
+      return error;
+    }
+
+  private:
+    struct Range {
+      uint64_t offset;
+      uint64_t size;
+    };
+
+    // 按顺序读取一段内存, 越界时返回 false
+    struct Cursor {
+      const char *p;
+      const char *end;
+
+      template<typename T>
+      bool read(T &val) {
+        return read_array(&val, 1);
+      }
+
+      template<typename T>
+      bool read_array(T *vals, size_t n) {
+        if((size_t)(end - p) / sizeof(T) < n) {
+          return false;
+        }
+        // 空数组的 data() 可以是 NULL, 不能传给 memcpy
+        if(n == 0) {
+          return true;
+        }
+        memcpy(vals, p, sizeof(T) * n);
+        p += sizeof(T) * n;
+        return true;
+      }
+    };
+
+    const char *data = NULL;
+    size_t size = 0;
+    std::vector<Range> funcs;
+    std::string error;
+
+    template<typename T>
+    bool read(uint64_t offset, T &val) const {
+      if(offset > size || size - offset < sizeof(T)) {
+        return false;
+      }
+      memcpy(&val, data + offset, sizeof(T));
+      return true;
+    }
+
+    bool corrupted(size_t i) {
+      error = "corrupted function #" + std::to_string(i);
+      return false;
+    }
+
+    // 检查指令和基本块中引用的编号都在范围内, 并且引用的指令种类正确, 后端访问时不会越界:
+    // 操作数引用的指令有值并且在某个基本块中, load/store 访问的是 alloc, 基本块参数是 IR_BLOCK_ARG,
+    // jump 传递的参数个数等于目标基本块的参数个数
+    static bool check(const IRFunction &func) {
+      int insts = func.insts.size();
+      int bbs = func.bbs.size();
+      auto inst_id = [&](int id) {
+        return id >= 0 && id < insts;
+      };
+      auto bb_id = [&](int id) {
+        return id >= 0 && id < bbs;
+      };
+      // 在基本块中出现过的指令, 后端只为它们分配位置
+      std::vector<bool> placed(insts);
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.params) {
+          if(!inst_id(id) || func.insts[id].tag != IR_BLOCK_ARG) {
+            return false;
+          }
+          placed[id] = true;
+        }
+        for(int id : bb.insts) {
+          if(!inst_id(id) || func.insts[id].tag == IR_BLOCK_ARG) {
+            return false;
+          }
+          placed[id] = true;
+        }
+      }
+      auto alloc_id = [&](int id) {
+        return inst_id(id) && placed[id] && func.insts[id].tag == IR_ALLOC;
+      };
+      // 指令的操作数不能是 NONE, 只有不被任何 jump 使用的 jump_args 可以是 NONE
+      auto operand = [&](const IROperand &opr) {
+        return opr.kind == IROperand::INTEGER ||
+               (opr.kind == IROperand::VALUE && inst_id(opr.val) && placed[opr.val] && ir_has_value(func.insts[opr.val]));
+      };
+      for(const auto &inst : func.insts) {
+        bool ok = true;
+        switch(inst.tag) {
+          case IR_ALLOC:
+            ok = inst.data.alloc.name >= 0 && inst.data.alloc.name < (int)func.names.size();
+            break;
+          case IR_LOAD:
+            ok = alloc_id(inst.data.load.src);
+            break;
+          case IR_STORE:
+            ok = operand(inst.data.store.value) && alloc_id(inst.data.store.dest);
+            break;
+          case IR_BINARY:
+            ok = operand(inst.data.binary.lhs) && operand(inst.data.binary.rhs);
+            break;
+          case IR_BRANCH:
+            ok = operand(inst.data.branch.cond) && bb_id(inst.data.branch.true_bb) && bb_id(inst.data.branch.false_bb);
+            break;
+          case IR_JUMP:
+            ok = bb_id(inst.data.jump.target) && inst.data.jump.args >= 0 &&
+                 inst.data.jump.arg_num == (int)func.bbs[inst.data.jump.target].params.size() &&
+                 inst.data.jump.args <= (int)func.jump_args.size() - inst.data.jump.arg_num;
+            for(int i = 0; ok && i < inst.data.jump.arg_num; i ++) {
+              ok = operand(func.jump_args[inst.data.jump.args + i]);
+            }
+            break;
+          case IR_RETURN:
+            ok = operand(inst.data.ret.value);
+            break;
+          case IR_BLOCK_ARG:
+            break;
+        }
+        if(!ok) {
+          return false;
+        }
+      }
+      for(const auto &arg : func.jump_args) {
+        if(arg.kind != IROperand::NONE && !operand(arg)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    static bool decode_operand(uint8_t kind, int32_t val, IROperand &opr) {
+      if(kind > IROperand::VALUE) {
+        return false;
+      }
+      opr.kind = (IROperand::Kind)kind;
+      opr.val = val;
+      return true;
+    }
+
+    static bool decode(const IRInstRecord &rec, IRInst &inst) {
+      if(rec.tag > IR_BLOCK_ARG) {
+        return false;
+      }
+      inst.tag = (IRInstTag)rec.tag;
+      switch(inst.tag) {
+        case IR_ALLOC:
+          inst.data.alloc.name = rec.a;
+          return true;
+        case IR_LOAD:
+          inst.data.load.src = rec.a;
+          return true;
+        case IR_STORE:
+          inst.data.store.dest = rec.b;
+          return decode_operand(rec.kind[0], rec.a, inst.data.store.value);
+        case IR_BINARY:
+          if(rec.op > IR_OR) {
+            return false;
+          }
+          inst.data.binary.op = (IRBinaryOp)rec.op;
+          return decode_operand(rec.kind[0], rec.a, inst.data.binary.lhs) &&
+                 decode_operand(rec.kind[1], rec.b, inst.data.binary.rhs);
+        case IR_BRANCH:
+          inst.data.branch.true_bb = rec.b;
+          inst.data.branch.false_bb = rec.c;
+          return decode_operand(rec.kind[0], rec.a, inst.data.branch.cond);
+        case IR_JUMP:
+          inst.data.jump.target = rec.a;
+          inst.data.jump.args = rec.b;
+          inst.data.jump.arg_num = rec.c;
+          return true;
+        case IR_RETURN:
+          return decode_operand(rec.kind[0], rec.a, inst.data.ret.value);
+        case IR_BLOCK_ARG:
+          return true;
+      }
+      return false;
+    }
+};
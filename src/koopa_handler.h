@@ -1,334 +1,661 @@
-#include <iostream>
 #include <cassert>
-#include <stdio.h>
-#include <unordered_map>
-#include "koopa.h"
+#include <climits>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "emitter.h"
+#include "context.h"
+#include "ir.h"
+#include "peephole.h"
+#include "regalloc.h"
+#include "riscv.h"
+#include "stats.h"
+#include "thread_pool.h"
+
+// 一个函数的代码生成结果
+// 函数的栈帧, 寄存器分配和指令都只依赖函数自己, 所以各个函数可以在不同线程上同时生成,
+// 每个函数写进自己的缓冲区和统计, 最后在调用者的线程上按函数的顺序合并
+struct FuncAsm {
+  // 生成的汇编
+  Emitter out{FUNC_BUF_SIZE};
+  Peephole peephole;
+  size_t stack_slots = 0;
+  size_t insts = 0;
+  // 生成这个函数时各个阶段的统计
+  StatsReport stats_report;
+
+  static const size_t FUNC_BUF_SIZE = 4096;
+};
+
+// IR 指令总数少于这个值时不值得创建线程, 在当前线程上依次生成各个函数
+static const size_t PARALLEL_MIN_INSTS = 4096;
 
 /* 函数声明 */
 
-// 访问 raw program
-void Visit(const koopa_raw_program_t &program);
-// 访问 raw slice
-void Visit(const koopa_raw_slice_t &slice);
-// 访问函数
-void Visit(const koopa_raw_function_t &func);
+// 访问 program; func_ends 不是 NULL 时记下每个函数的代码结束时 out 的大小
+void Visit(const IRProgram &program, Emitter &out, std::vector<size_t> *func_ends = NULL);
+// 访问函数, 可以在任何线程上调用
+void Visit(const IRFunction &func, FuncAsm &res);
+// 下面的函数把生成的指令追加到 code 中
 // 访问基本块
-void Visit(const koopa_raw_basic_block_t &bb);
+void Visit(const IRBasicBlock &bb, std::vector<RVInst> &code);
 // 访问指令
-void Visit(const koopa_raw_value_t &value);
+void Visit(int value, std::vector<RVInst> &code);
 // 访问 return
-void Visit(const koopa_raw_return_t &ret);
-// 访问 int
-void Visit(const koopa_raw_integer_t &i32);
+void Visit(const IRReturn &ret, std::vector<RVInst> &code);
+// 访问 branch
+void Visit(const IRBranch &branch, std::vector<RVInst> &code);
+// 访问 jump
+void Visit(const IRJump &jump, std::vector<RVInst> &code);
 // 访问 binary
-void Visit(const koopa_raw_binary_t &bin);
+void Visit(const IRBinary &bin, std::vector<RVInst> &code);
 // 访问 load
-void Visit(const koopa_raw_load_t &load);
+void Visit(const IRLoad &load, std::vector<RVInst> &code);
 // 访问 store
-void Visit(const koopa_raw_store_t &store);
+void Visit(const IRStore &store, std::vector<RVInst> &code);
+
+// 计算需要分配的栈空间总量(单位：字节), 同时把栈上的值的位置编号换算成偏移量
+int cal_alloc_size(const IRFunction &func, int slot_num);
+
+// 把操作数放进寄存器, 返回寄存器; 常量和溢出到栈上的值会用到临时寄存器 scratch
+int dump_operand(const IROperand &opr, int scratch, std::vector<RVInst> &code);
+// 当前指令的结果应该写入的寄存器, 溢出的值先写入临时寄存器 t0
+int dest_reg();
+// 如果当前指令的结果溢出到了栈上, 把它从 t0 写回栈帧
+void dump_spill(std::vector<RVInst> &code);
+// 右操作数是常量 imm 时, 用立即数形式的指令或者移位代替 li 加寄存器形式的指令
+// 不能这样做时返回 false, 并且不生成任何指令
+bool dump_binary_imm(IRBinaryOp op, const IROperand &lhs, int imm, int rd, std::vector<RVInst> &code);
 
-// 计算需要分配的栈空间总量(单位：字节)
-int cal_alloc_size(const koopa_raw_slice_t &slice);
-int cal_alloc_size(const koopa_raw_function_t &func);
-int cal_alloc_size(const koopa_raw_basic_block_t &bb);
-int cal_alloc_size(const koopa_raw_value_t &value);
+// 在 jump 之前把参数并行地传给目标基本块的参数
+void dump_block_args(const IRJump &jump, std::vector<RVInst> &code);
 
-// 输出 lw/sw 指令
-void dump_lw_sw(std::string rs1, std::string rs2, int offset, std::string type);
+// 生成 lw/sw 指令, 访问 base + offset
+void dump_lw_sw(RVOp op, int reg, int base, int offset, std::vector<RVInst> &code);
+// 生成 sp += imm
+void dump_add_sp(int imm, std::vector<RVInst> &code);
 
 /* 全局变量 */
 
-// 某条指令执行完毕之后的 rd 编号
-static int cur;
-// 访问 integer 后得到的值
-std::string int_res;
+// 下面都是翻译一个函数时的状态, 每个函数开始时重新设置
+// 不同线程会同时翻译不同的函数, 所以每个线程各有一份
+
 // 记录函数分配的内存大小
-static int alloc_size;
-// 记录当前栈顶的偏移量
-static int offset;
-// 记录 koopa 指令对应的栈帧偏移量
-std::unordered_map<koopa_raw_value_t, int> value_offset;
-
-// 访问 raw program
-void Visit(const koopa_raw_program_t &program) {
-  printf("  .text\n");
+static thread_local int alloc_size;
+// 当前正在访问的函数
+static thread_local const IRFunction *cur_func;
+// 当前正在访问的基本块的下标
+static thread_local int cur_bb;
+// 当前正在访问的指令
+static thread_local int cur_value;
+// 记录栈上的值 (alloc 和溢出的值) 对应的栈帧偏移量, 下标是指令编号
+// 活跃区间不重叠的值可能共用同一个偏移量
+thread_local std::vector<int> value_offset;
+// 记录值分到的寄存器在 alloc_regs 中的下标, -1 表示在栈上
+thread_local std::vector<int> value_reg;
+// 函数用到的 callee-saved 寄存器, 以及它们在栈帧中的保存位置
+thread_local std::vector<std::pair<int, int>> saved_regs;
+
+// 访问 program, 可能只是输入文件中的一部分函数, 所以 .text 由调用者输出
+void Visit(const IRProgram &program, Emitter &out, std::vector<size_t> *func_ends) {
   // 执行一些其他的必要操作
   // ...
-  // 访问所有全局变量
-  Visit(program.values);
-  // 访问所有函数
-  Visit(program.funcs);
-}
-
-// 访问 raw slice
-void Visit(const koopa_raw_slice_t &slice) {
-  for (size_t i = 0; i < slice.len; ++i) {
-    auto ptr = slice.buffer[i];
-    // 根据 slice 的 kind 决定将 ptr 视作何种元素
-    switch (slice.kind) {
-      case KOOPA_RSIK_FUNCTION:
-        // 访问函数
-        Visit(reinterpret_cast<koopa_raw_function_t>(ptr));
-        break;
-      case KOOPA_RSIK_BASIC_BLOCK:
-        // 访问基本块
-        Visit(reinterpret_cast<koopa_raw_basic_block_t>(ptr));
-        break;
-      case KOOPA_RSIK_VALUE:
-        // 访问指令
-        Visit(reinterpret_cast<koopa_raw_value_t>(ptr));
-        break;
-      default:
-        // 我们暂时不会遇到其他内容, 于是不对其做任何处理
-        assert(false);
+  // 访问所有函数, 指令足够多时用 cur_ctx->backend_threads 个线程同时生成
+  const auto &funcs = program.funcs;
+  size_t insts = 0;
+  for(const auto &func : funcs) {
+    for(const auto &bb : func.bbs) {
+      insts += bb.insts.size();
+    }
+  }
+  size_t thread_num = insts < PARALLEL_MIN_INSTS ? 1 : cur_ctx->backend_threads;
+  std::vector<FuncAsm> asms(funcs.size());
+  parallel_for(funcs.size(), thread_num, [&](size_t i) {
+    // 各阶段的统计先记在函数自己的报告里, 其他线程上没有当前编译的报告
+    StatsReport *report = cur_report;
+    cur_report = &asms[i].stats_report;
+    Visit(funcs[i], asms[i]);
+    cur_report = report;
+  });
+  // 按函数的顺序合并, 所以输出和线程数无关
+  for(const auto &res : asms) {
+    out << res.out;
+    if(func_ends != NULL) {
+      func_ends->push_back(out.size());
+    }
+    cur_ctx->backend_stats.stack_slots += res.stack_slots;
+    cur_ctx->backend_stats.insts += res.insts;
+    cur_ctx->peephole.merge(res.peephole.stats());
+    if(cur_report != NULL) {
+      cur_report->merge(res.stats_report);
     }
   }
 }
 
 // 访问函数
-void Visit(const koopa_raw_function_t &func) {
-  printf("  .globl %s\n", func->name + 1);
-  printf("%s:\n", func->name + 1);
-  // 计算程序中需要分配的栈空间总量
-  alloc_size = cal_alloc_size(func);
-  // 将栈空间总量对齐到 16
-  alloc_size = (alloc_size + 15) & ~15;
-  // 函数的 prologue
-  if(-alloc_size >= -2048 && -alloc_size <= 2047) {
-    std::cout << "  addi  sp, sp, " << -alloc_size << std::endl;
-  } else {
-    std::cout << "  li    t" << cur << ", " << -alloc_size << std::endl;
-    std::cout << "  add   sp, sp, t0" << std::endl;
+void Visit(const IRFunction &func, FuncAsm &res) {
+  Emitter &out = res.out;
+  out << "  .globl " << func.name << '\n';
+  out << func.name << ":\n";
+  cur_func = &func;
+  std::vector<RVInst> code;
+  // 寄存器分配
+  int slot_num;
+  {
+    PhaseTimer timer("regalloc");
+    std::vector<LiveInterval> intervals = build_intervals(func);
+    value_reg = linear_scan(func, intervals);
+    value_offset = color_stack_slots(func, intervals, value_reg, slot_num);
+  }
+  res.stack_slots = slot_num;
+  // 指令选择
+  {
+    PhaseTimer timer("isel");
+    // 计算程序中需要分配的栈空间总量
+    alloc_size = cal_alloc_size(func, slot_num);
+    // 将栈空间总量对齐到 16
+    alloc_size = (alloc_size + 15) & ~15;
+    // 函数的 prologue
+    dump_add_sp(-alloc_size, code);
+    for(const auto &saved : saved_regs) {
+      dump_lw_sw(RV_SW, alloc_regs[saved.first], RV_SP, saved.second, code);
+    }
+    // 访问所有基本块, 入口基本块紧跟在 prologue 之后, 不需要标号
+    for(cur_bb = 0; cur_bb < (int)func.bbs.size(); cur_bb ++) {
+      if(cur_bb > 0) {
+        code.push_back(rv_inst(RV_LABEL, -1, -1, -1, cur_bb));
+      }
+      Visit(func.bbs[cur_bb], code);
+    }
+  }
+  // 窥孔优化之后再输出
+  {
+    PhaseTimer timer("peephole");
+    res.peephole.run(code);
+  }
+  res.insts = code.size();
+  PhaseTimer timer("emit");
+  for(const auto &inst : code) {
+    DumpRISCV(func.name, inst, out);
   }
-  // 访问所有基本块
-  Visit(func->bbs);
 }
 
 // 访问基本块
-void Visit(const koopa_raw_basic_block_t &bb) {
+void Visit(const IRBasicBlock &bb, std::vector<RVInst> &code) {
   // 执行一些其他的必要操作
   // ...
   // 访问所有指令
-  Visit(bb->insts);
+  for(int value : bb.insts) {
+    Visit(value, code);
+  }
 }
 
 // 访问指令
-void Visit(const koopa_raw_value_t &value) {
+void Visit(int value, std::vector<RVInst> &code) {
   // 根据指令类型判断后续需要如何访问
-  const auto &kind = value->kind;
-  switch (kind.tag) {
-    case KOOPA_RVT_INTEGER:
-      // 访问 integer 指令
-      Visit(kind.data.integer);
+  const auto &inst = cur_func->insts[value];
+  cur_value = value;
+  switch (inst.tag) {
+    case IR_ALLOC:
       break;
-    case KOOPA_RVT_ALLOC:
-      break;
-    case KOOPA_RVT_LOAD:
+    case IR_LOAD:
       // 访问 load 指令
-      Visit(kind.data.load);
+      Visit(inst.data.load, code);
       break;
-    case KOOPA_RVT_STORE:
+    case IR_STORE:
       // 访问 store 指令
-      Visit(kind.data.store);
+      Visit(inst.data.store, code);
       break;
-    case KOOPA_RVT_BINARY:
+    case IR_BINARY:
       // 访问 binary 指令
-      Visit(kind.data.binary);
+      Visit(inst.data.binary, code);
+      break;
+    case IR_BRANCH:
+      // 访问 br 指令
+      Visit(inst.data.branch, code);
       break;
-    case KOOPA_RVT_RETURN:
+    case IR_JUMP:
+      // 访问 jump 指令
+      Visit(inst.data.jump, code);
+      break;
+    case IR_RETURN:
       // 访问 return 指令
-      Visit(kind.data.ret);
+      Visit(inst.data.ret, code);
       break;
     default:
       // 其他类型暂时遇不到
       assert(false);
   }
-  if(value->ty->tag != KOOPA_RTT_UNIT) {
-    value_offset[value] = offset;
-    offset += 4;
-  }
-  cur = 0;
-  std::cout << std::endl;
 }
 
 // 访问 return
-void Visit(const koopa_raw_return_t &ret) {
-  if(ret.value->kind.tag == KOOPA_RVT_INTEGER) {
-    std::cout << "  li    a0, " << ret.value->kind.data.integer.value << std::endl;
-    std::cout << "  ret" << std::endl;
+void Visit(const IRReturn &ret, std::vector<RVInst> &code) {
+  if(ret.value.kind == IROperand::INTEGER) {
+    code.push_back(rv_inst(RV_LI, RV_A0, -1, -1, ret.value.val));
   } else {
-    int os = value_offset[ret.value];
-    dump_lw_sw("a0", "sp", os, "lw");
-    // 函数的 epilogue
-    if(alloc_size >= -2048 && alloc_size <= 2047) {
-      std::cout << "  addi  sp, sp, " << alloc_size << std::endl;
-    } else {
-      std::cout << "  li    t" << cur << ", " << alloc_size << std::endl;
-      std::cout << "  add   sp, sp, t" << cur << std::endl;
+    int rs = dump_operand(ret.value, RV_A0, code);
+    if(rs != RV_A0) {
+      code.push_back(rv_inst(RV_MV, RV_A0, rs, -1, -1));
     }
-    std::cout << "  ret";
   }
+  // 函数的 epilogue
+  for(const auto &saved : saved_regs) {
+    dump_lw_sw(RV_LW, alloc_regs[saved.first], RV_SP, saved.second, code);
+  }
+  dump_add_sp(alloc_size, code);
+  code.push_back(rv_inst(RV_RET, -1, -1, -1, -1));
 }
 
-// 访问 int
-void Visit(const koopa_raw_integer_t &i32) {
-  if(i32.value == 0) {
-    int_res = "x0";
-  } else {
-    std::string rd = "t" + std::to_string(cur);
-    std::cout << "  li    " << rd << ", " << i32.value << std::endl;
-    int_res = "t" + std::to_string(cur);
+// 访问 br 指令, 目标是紧跟着的基本块时不需要跳转
+void Visit(const IRBranch &branch, std::vector<RVInst> &code) {
+  int rs = dump_operand(branch.cond, RV_T0, code);
+  if(branch.true_bb == cur_bb + 1) {
+    code.push_back(rv_inst(RV_BEQZ, -1, rs, -1, branch.false_bb));
+    return;
+  }
+  code.push_back(rv_inst(RV_BNEZ, -1, rs, -1, branch.true_bb));
+  if(branch.false_bb != cur_bb + 1) {
+    code.push_back(rv_inst(RV_J, -1, -1, -1, branch.false_bb));
   }
 }
 
-void Visit(const koopa_raw_load_t &load) {
-  std::string rs = "t" + std::to_string(cur);
-  int lw_os = value_offset[load.src];
-  int sw_os = offset;
-  dump_lw_sw(rs, "sp", lw_os, "lw");
-  dump_lw_sw(rs, "sp", sw_os, "sw");
+void Visit(const IRJump &jump, std::vector<RVInst> &code) {
+  dump_block_args(jump, code);
+  if(jump.target != cur_bb + 1) {
+    code.push_back(rv_inst(RV_J, -1, -1, -1, jump.target));
+  }
 }
 
-void Visit(const koopa_raw_store_t &store) {
-  std::string rs = "t" + std::to_string(cur);
-  if(store.value->kind.tag == KOOPA_RVT_INTEGER) {
-    std::cout << "  li    " << rs << ", " << store.value->kind.data.integer.value << std::endl;
-  } else {
-    int lw_os = value_offset[store.value];
-    dump_lw_sw(rs, "sp", lw_os, "lw");
-  }
-  int sw_os = value_offset[store.dest];
-  dump_lw_sw(rs, "sp", sw_os, "sw");
+void Visit(const IRLoad &load, std::vector<RVInst> &code) {
+  dump_lw_sw(RV_LW, dest_reg(), RV_SP, value_offset[load.src], code);
+  dump_spill(code);
+}
+
+void Visit(const IRStore &store, std::vector<RVInst> &code) {
+  int rs = dump_operand(store.value, RV_T0, code);
+  dump_lw_sw(RV_SW, rs, RV_SP, value_offset[store.dest], code);
 }
 
 // 访问 binary 指令
-void Visit(const koopa_raw_binary_t &bin) {
-  std::string rd, rs1, rs2;
-  int os1, os2;
-  if(bin.lhs->kind.tag == KOOPA_RVT_INTEGER) {
-    Visit(bin.lhs);
-    rs1 = int_res;
-  } else {
-    os1 = value_offset[bin.lhs];
-    rs1 = "t" + std::to_string(cur);
-    dump_lw_sw(rs1, "sp", os1, "lw");
-  }
-  cur ++;
-  if(bin.rhs->kind.tag == KOOPA_RVT_INTEGER) {
-    Visit(bin.rhs);
-    rs2 = int_res;
-  } else {
-    os2 = value_offset[bin.rhs];
-    rs2 = "t" + std::to_string(cur + 1);
-    dump_lw_sw(rs2, "sp", os2, "lw");
-  }
-  rd = "t" + std::to_string(cur);
-  switch (bin.op) {
-    case KOOPA_RBO_NOT_EQ:
-      std::cout << "  xor   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
-      std::cout << "  snez  " << rd << ", " << rd << std::endl;
+void Visit(const IRBinary &bin, std::vector<RVInst> &code) {
+  IRBinaryOp op = bin.op;
+  IROperand lhs = bin.lhs, rhs = bin.rhs;
+  // 常量尽量放到右边, 比较运算交换操作数时要换成相反的比较
+  if(lhs.kind == IROperand::INTEGER && rhs.kind != IROperand::INTEGER) {
+    switch(op) {
+      case IR_GT: op = IR_LT; break;
+      case IR_LT: op = IR_GT; break;
+      case IR_GE: op = IR_LE; break;
+      case IR_LE: op = IR_GE; break;
+      default: break;
+    }
+    if(op != IR_SUB && op != IR_DIV && op != IR_MOD) {
+      std::swap(lhs, rhs);
+    }
+  }
+  int rd = dest_reg();
+  if(rhs.kind == IROperand::INTEGER && dump_binary_imm(op, lhs, rhs.val, rd, code)) {
+    dump_spill(code);
+    return;
+  }
+  int rs1 = dump_operand(lhs, RV_T0, code);
+  int rs2 = dump_operand(rhs, RV_T1, code);
+  switch (op) {
+    case IR_NOT_EQ:
+      code.push_back(rv_inst(RV_XOR, rd, rs1, rs2, -1));
+      code.push_back(rv_inst(RV_SNEZ, rd, rd, -1, -1));
+      break;
+    case IR_EQ:
+      code.push_back(rv_inst(RV_XOR, rd, rs1, rs2, -1));
+      code.push_back(rv_inst(RV_SEQZ, rd, rd, -1, -1));
+      break;
+    case IR_GT:
+      code.push_back(rv_inst(RV_SGT, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_EQ:
-      std::cout << "  xor   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
-      std::cout << "  seqz  " << rd << ", " << rd << std::endl;
+    case IR_LT:
+      code.push_back(rv_inst(RV_SLT, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_GT:
-      std::cout << "  sgt   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_GE:
+      code.push_back(rv_inst(RV_SLT, rd, rs1, rs2, -1));
+      code.push_back(rv_inst(RV_SEQZ, rd, rd, -1, -1));
       break;
-    case KOOPA_RBO_LT:
-      std::cout << "  slt   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_LE:
+      code.push_back(rv_inst(RV_SGT, rd, rs1, rs2, -1));
+      code.push_back(rv_inst(RV_SEQZ, rd, rd, -1, -1));
       break;
-    case KOOPA_RBO_GE:
-      std::cout << "  slt   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
-      std::cout << "  seqz  " << rd << ", " << rd << std::endl;
+    case IR_ADD:
+      code.push_back(rv_inst(RV_ADD, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_LE:
-      std::cout << "  sgt   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
-      std::cout << "  seqz  " << rd << ", " << rd << std::endl;
+    case IR_SUB:
+      code.push_back(rv_inst(RV_SUB, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_ADD:
-      std::cout << "  add   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_MUL:
+      code.push_back(rv_inst(RV_MUL, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_SUB:
-      std::cout << "  sub   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_DIV:
+      code.push_back(rv_inst(RV_DIV, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_MUL:
-      std::cout << "  mul   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_MOD:
+      code.push_back(rv_inst(RV_REM, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_DIV:
-      std::cout << "  div   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_AND:
+      code.push_back(rv_inst(RV_AND, rd, rs1, rs2, -1));
       break;
-    case KOOPA_RBO_MOD:
-      std::cout << "  rem   " << rd << ", " << rs1 << ", " << rs2 << std::endl;
+    case IR_OR:
+      code.push_back(rv_inst(RV_OR, rd, rs1, rs2, -1));
       break;
     default:
       assert(false);
   }
-  // 将返回值写入栈帧中
-  dump_lw_sw(rd, "sp", offset, "sw");
+  // 结果溢出时写回栈帧
+  dump_spill(code);
 }
 
-int cal_alloc_size(const koopa_raw_slice_t &slice) {
-  int res = 0;
-  for(size_t i = 0; i < slice.len; i ++) {
-    auto ptr = slice.buffer[i];
-    switch(slice.kind) {
-      case KOOPA_RSIK_FUNCTION:
-        res += cal_alloc_size(reinterpret_cast<koopa_raw_function_t>(ptr));
-        break;
-      case KOOPA_RSIK_BASIC_BLOCK:
-        res += cal_alloc_size(reinterpret_cast<koopa_raw_basic_block_t>(ptr));
-        break;
-      case KOOPA_RSIK_VALUE:
-        res += cal_alloc_size(reinterpret_cast<koopa_raw_value_t>(ptr));
-        break;
-      default:
-        assert(false);
+// val 是 2 的 k 次幂 (k >= 1) 时返回 k, 否则返回 -1
+int log2_exact(long long val) {
+  if(val < 2 || (val & (val - 1)) != 0) {
+    return -1;
+  }
+  int k = 0;
+  while((1ll << k) != val) {
+    k ++;
+  }
+  return k;
+}
+
+// 生成的序列都在读完 lhs 之后才写 rd (rd 可能和 lhs 是同一个寄存器), 中间结果放在 t1 (右操作数是常量, 用不到 t1)
+bool dump_binary_imm(IRBinaryOp op, const IROperand &lhs, int imm, int rd, std::vector<RVInst> &code) {
+  long long c = imm;
+  auto push = [&](RVOp rv_op, int d, int s1, int s2, int i) {
+    code.push_back(rv_inst(rv_op, d, s1, s2, i));
+  };
+  int rs;
+  switch(op) {
+    case IR_ADD:
+    case IR_SUB:
+      if(op == IR_SUB) {
+        c = -c;
+      }
+      if(!rv_is_imm12(c)) {
+        return false;
+      }
+      rs = dump_operand(lhs, RV_T0, code);
+      push(RV_ADDI, rd, rs, -1, c);
+      return true;
+    case IR_AND:
+    case IR_OR:
+      if(!rv_is_imm12(c)) {
+        return false;
+      }
+      rs = dump_operand(lhs, RV_T0, code);
+      push(op == IR_AND ? RV_ANDI : RV_ORI, rd, rs, -1, c);
+      return true;
+    case IR_EQ:
+    case IR_NOT_EQ:
+      if(!rv_is_imm12(c)) {
+        return false;
+      }
+      rs = dump_operand(lhs, RV_T0, code);
+      if(c != 0) {
+        push(RV_XORI, rd, rs, -1, c);
+        rs = rd;
+      }
+      push(op == IR_EQ ? RV_SEQZ : RV_SNEZ, rd, rs, -1, -1);
+      return true;
+    case IR_LT:
+    case IR_GE:
+    case IR_GT:
+    case IR_LE:
+      // x > c 就是 !(x < c + 1), x <= c 就是 x < c + 1
+      if(op == IR_GT || op == IR_LE) {
+        c ++;
+      }
+      if(!rv_is_imm12(c)) {
+        return false;
+      }
+      rs = dump_operand(lhs, RV_T0, code);
+      push(RV_SLTI, rd, rs, -1, c);
+      if(op == IR_GE || op == IR_GT) {
+        push(RV_XORI, rd, rd, -1, 1);
+      }
+      return true;
+    case IR_MUL: {
+      if(c == INT_MIN) {
+        return false;
+      }
+      int k = log2_exact(c < 0 ? -c : c);
+      if(c == -1 || k != -1) {
+        // x * -1 = 0 - x, x * (+-2^k) = +-(x << k)
+        rs = dump_operand(lhs, RV_T0, code);
+        if(k != -1) {
+          push(RV_SLLI, rd, rs, -1, k);
+          rs = rd;
+        }
+        if(c < 0) {
+          push(RV_SUB, rd, RV_X0, rs, -1);
+        }
+        return true;
+      }
+      // x * (2^k + 1) = (x << k) + x, x * (2^k - 1) = (x << k) - x
+      int add_k = log2_exact(c - 1), sub_k = log2_exact(c + 1);
+      if(c <= 0 || (add_k == -1 && sub_k == -1)) {
+        return false;
+      }
+      rs = dump_operand(lhs, RV_T0, code);
+      push(RV_SLLI, RV_T1, rs, -1, add_k != -1 ? add_k : sub_k);
+      push(add_k != -1 ? RV_ADD : RV_SUB, rd, RV_T1, rs, -1);
+      return true;
+    }
+    case IR_DIV:
+    case IR_MOD: {
+      if(c == -1 && op == IR_DIV) {
+        rs = dump_operand(lhs, RV_T0, code);
+        push(RV_SUB, rd, RV_X0, rs, -1);
+        return true;
+      }
+      int k = c == INT_MIN ? -1 : log2_exact(c < 0 ? -c : c);
+      if(k == -1) {
+        return false;
+      }
+      // 有符号除法向 0 取整: 负数先加上 2^k - 1 再算术右移
+      // 偏移量是 x 的符号位扩展后逻辑右移 32 - k 位得到的
+      rs = dump_operand(lhs, RV_T0, code);
+      if(k == 1) {
+        push(RV_SRLI, RV_T1, rs, -1, 31);
+      } else {
+        push(RV_SRAI, RV_T1, rs, -1, 31);
+        push(RV_SRLI, RV_T1, RV_T1, -1, 32 - k);
+      }
+      push(RV_ADD, RV_T1, rs, RV_T1, -1);
+      if(op == IR_DIV) {
+        push(RV_SRAI, rd, RV_T1, -1, k);
+        if(c < 0) {
+          push(RV_SUB, rd, RV_X0, rd, -1);
+        }
+        return true;
+      }
+      // 余数 = x - (x / 2^k) * 2^k, 符号和 x 相同, 所以除数的符号不影响结果
+      if(rv_is_imm12(-(1ll << k))) {
+        push(RV_ANDI, RV_T1, RV_T1, -1, -(1 << k));
+      } else {
+        push(RV_SRAI, RV_T1, RV_T1, -1, k);
+        push(RV_SLLI, RV_T1, RV_T1, -1, k);
+      }
+      push(RV_SUB, rd, rs, RV_T1, -1);
+      return true;
     }
+    default:
+      return false;
+  }
+}
+
+// 栈帧布局: 栈上的值共用 slot_num 个 4 字节的位置, 之后是需要保存的 callee-saved 寄存器
+int cal_alloc_size(const IRFunction &func, int slot_num) {
+  for(int &os : value_offset) {
+    if(os != -1) {
+      os *= 4;
+    }
+  }
+  int size = slot_num * 4;
+  std::vector<bool> used(ALLOC_REG_NUM);
+  for(int r : value_reg) {
+    if(r != -1) {
+      used[r] = true;
+    }
+  }
+  saved_regs.clear();
+  for(int r = FIRST_CALLEE_SAVED; r < ALLOC_REG_NUM; r ++) {
+    if(used[r]) {
+      saved_regs.emplace_back(r, size);
+      size += 4;
+    }
+  }
+  return size;
+}
+
+int dump_operand(const IROperand &opr, int scratch, std::vector<RVInst> &code) {
+  if(opr.kind == IROperand::INTEGER) {
+    if(opr.val == 0) {
+      return RV_X0;
+    }
+    code.push_back(rv_inst(RV_LI, scratch, -1, -1, opr.val));
+    return scratch;
+  }
+  if(value_reg[opr.val] != -1) {
+    return alloc_regs[value_reg[opr.val]];
+  }
+  dump_lw_sw(RV_LW, scratch, RV_SP, value_offset[opr.val], code);
+  return scratch;
+}
+
+int dest_reg() {
+  if(value_reg[cur_value] != -1) {
+    return alloc_regs[value_reg[cur_value]];
+  }
+  return RV_T0;
+}
+
+void dump_spill(std::vector<RVInst> &code) {
+  if(value_reg[cur_value] == -1) {
+    dump_lw_sw(RV_SW, RV_T0, RV_SP, value_offset[cur_value], code);
   }
-  return res;
 }
 
-int cal_alloc_size(const koopa_raw_function_t &func) {
-  return cal_alloc_size(func->bbs);
+// 值所在的位置: 寄存器 (reg 不为 -1), 或者栈帧中的偏移量
+struct Location {
+  int reg;
+  int offset;
+
+  bool operator==(const Location &other) const {
+    return reg == other.reg && (reg != -1 || offset == other.offset);
+  }
+};
+
+// 基本块参数传递中的一次赋值, 源是常量 (is_imm) 或者某个位置
+struct Move {
+  bool is_imm;
+  int imm;
+  Location src;
+  Location dst;
+};
+
+Location value_loc(int value) {
+  if(value_reg[value] != -1) {
+    return Location{alloc_regs[value_reg[value]], -1};
+  }
+  return Location{-1, value_offset[value]};
 }
 
-int cal_alloc_size(const koopa_raw_basic_block_t &bb) {
-  return cal_alloc_size(bb->insts);
+void dump_move(const Move &move, std::vector<RVInst> &code) {
+  if(move.dst.reg != -1) {
+    if(move.is_imm) {
+      code.push_back(rv_inst(RV_LI, move.dst.reg, -1, -1, move.imm));
+    } else if(move.src.reg != -1) {
+      code.push_back(rv_inst(RV_MV, move.dst.reg, move.src.reg, -1, -1));
+    } else {
+      dump_lw_sw(RV_LW, move.dst.reg, RV_SP, move.src.offset, code);
+    }
+    return;
+  }
+  int rs = move.src.reg;
+  if(move.is_imm) {
+    rs = move.imm == 0 ? RV_X0 : RV_T0;
+    if(move.imm != 0) {
+      code.push_back(rv_inst(RV_LI, RV_T0, -1, -1, move.imm));
+    }
+  } else if(rs == -1) {
+    dump_lw_sw(RV_LW, RV_T0, RV_SP, move.src.offset, code);
+    rs = RV_T0;
+  }
+  dump_lw_sw(RV_SW, rs, RV_SP, move.dst.offset, code);
 }
 
-int cal_alloc_size(const koopa_raw_value_t &value) {
-  int res = 0;
-  if(value->ty->tag != KOOPA_RTT_UNIT) res += 4;
-  return res;
+// 所有赋值同时发生: 目的位置不再被其他赋值读取时才能写入它;
+// 剩下的赋值都在环上时, 先把其中一个目的位置的旧值挪到 t1, 让读它的赋值改成读 t1, 这样环就断开了
+void dump_block_args(const IRJump &jump, std::vector<RVInst> &code) {
+  const auto &params = cur_func->bbs[jump.target].params;
+  std::vector<Move> moves;
+  for(int i = 0; i < jump.arg_num; i ++) {
+    const IROperand &arg = cur_func->jump_args[jump.args + i];
+    Move move;
+    move.is_imm = arg.kind == IROperand::INTEGER;
+    move.imm = arg.val;
+    move.dst = value_loc(params[i]);
+    if(!move.is_imm) {
+      move.src = value_loc(arg.val);
+      if(move.src == move.dst) {
+        continue;
+      }
+    }
+    moves.push_back(move);
+  }
+  while(!moves.empty()) {
+    bool progress = false;
+    for(size_t i = 0; i < moves.size() && !progress; i ++) {
+      bool blocked = false;
+      for(size_t j = 0; j < moves.size(); j ++) {
+        blocked |= j != i && !moves[j].is_imm && moves[j].src == moves[i].dst;
+      }
+      if(!blocked) {
+        dump_move(moves[i], code);
+        moves.erase(moves.begin() + i);
+        progress = true;
+      }
+    }
+    if(!progress) {
+      Location saved = moves[0].dst, tmp{RV_T1, -1};
+      dump_move(Move{false, 0, saved, tmp}, code);
+      for(auto &move : moves) {
+        if(!move.is_imm && move.src == saved) {
+          move.src = tmp;
+        }
+      }
+    }
+  }
 }
 
-void dump_lw_sw(std::string rs1, std::string rs2, int offset, std::string type) {
-  if(offset >= -2048 && offset <= 2047) {
-    std::cout << "  " << type << "    " << rs1 << ", " << offset << "(" << rs2 << ")" << std::endl;
+// 偏移量超出 12 位立即数的范围时, 先用 t2 算出地址
+void dump_lw_sw(RVOp op, int reg, int base, int offset, std::vector<RVInst> &code) {
+  int rd = op == RV_LW ? reg : -1;
+  int rs2 = op == RV_SW ? reg : -1;
+  if(rv_is_imm12(offset)) {
+    code.push_back(rv_inst(op, rd, base, rs2, offset));
   } else {
-    std::cout << "  " << type << "    " << rs1 << ", " << offset << std::endl;
-    std::cout << "  " << type << "    " << rs1 << ", " << rs1 << "(" << rs2 << ")" << std::endl;
+    code.push_back(rv_inst(RV_LI, RV_T2, -1, -1, offset));
+    code.push_back(rv_inst(RV_ADD, RV_T2, base, RV_T2, -1));
+    code.push_back(rv_inst(op, rd, RV_T2, rs2, 0));
   }
 }
 
-// 解析字符串 str, 得到 Koopa IR 的内存表示
-void parse_string_to_koopa(const char* str) {
-  koopa_program_t program;
-  koopa_error_code_t ret = koopa_parse_from_string(str, &program);
-  assert(ret == KOOPA_EC_SUCCESS);  // 确保解析时没有出错
-  // 创建一个 raw program builder, 用来构建 raw program
-  koopa_raw_program_builder_t builder = koopa_new_raw_program_builder();
-  // 将 Koopa IR 程序转换为 raw program
-  koopa_raw_program_t raw = koopa_build_raw_program(builder, program);
-  // 释放 Koopa IR 程序占用的内存
-  koopa_delete_program(program);
-
-  // 处理 raw program
-  Visit(raw);
-
-  // 处理完成, 释放 raw program builder 占用的内存
-  // 注意, raw program 中所有的指针指向的内存均为 raw program builder 的内存
-  // 所以不要在 raw program 处理完毕之前释放 builder
-  koopa_delete_raw_program_builder(builder);
-}
\ No newline at end of file
+void dump_add_sp(int imm, std::vector<RVInst> &code) {
+  // 栈帧为空时不需要移动 sp
+  if(imm == 0) {
+    return;
+  }
+  if(rv_is_imm12(imm)) {
+    code.push_back(rv_inst(RV_ADDI, RV_SP, RV_SP, -1, imm));
+  } else {
+    code.push_back(rv_inst(RV_LI, RV_T0, -1, -1, imm));
+    code.push_back(rv_inst(RV_ADD, RV_SP, RV_SP, RV_T0, -1));
+  }
+}
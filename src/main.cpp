@@ -1,53 +1,342 @@
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
-#include <iostream>
+#include <cstdlib>
+#include <fcntl.h>
 #include <memory>
 #include <string>
 #include <string.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 #include <ast.h>
-#include "koopa_handler.h"
+#include "compile_cache.h"
+#include "context.h"
+#include "emitter.h"
+#include "fast_lexer.h"
+#include "stats.h"
+#include "stream.h"
+#include "thread_pool.h"
 
 using namespace std;
 
-// 声明 lexer 的输入, 以及 parser 函数
-// 为什么不引用 sysy.tab.hpp 呢? 因为首先里面没有 yyin 的定义
+// 声明 lexer 和 parser 的函数
+// 为什么不引用 sysy.tab.hpp 呢? 因为首先里面没有 lexer 的函数的定义
 // 其次, 因为这个文件不是我们自己写的, 而是被 Bison 生成出来的
 // 你的代码编辑器/IDE 很可能找不到这个文件, 然后会给你报错 (虽然编译不会出错)
 // 看起来会很烦人, 于是干脆采用这种看起来 dirty 但实际很有效的手段
-extern FILE *yyin;
-extern int yyparse(unique_ptr<BaseAST> &ast);
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;
+#endif
+extern int yylex_init(yyscan_t *scanner);
+extern void yyset_in(FILE *in, yyscan_t scanner);
+extern int yylex_destroy(yyscan_t scanner);
+extern int yyparse(Lexer *lexer, FunctionStream *stream);
+
+// 一个输入文件的编译任务
+struct CompileJob {
+  const char *input;
+  const char *output;
+  bool ok = false;
+  // -stats 的报告
+  std::string report;
+};
+
+// 把各个模块的统计信息收集到当前编译的报告中
+static void collect_counters() {
+  StatsReport &stats_report = cur_ctx->stats_report;
+  if(cur_ctx->cache_hit) {
+    // 输出是从缓存复制的, 没有经过各个模块
+    stats_report.counter("cache hits", 1);
+    return;
+  }
+  const auto &arena = cur_ctx->ast_arena.stats();
+  size_t tokens = stats_report.lex_phase == -1 ? 0 : stats_report[stats_report.lex_phase].calls;
+  stats_report.counter("tokens", tokens);
+  stats_report.counter("ast nodes", arena.objects);
+  stats_report.counter("ast bytes", arena.bytes);
+  stats_report.counter("arena chunks", arena.chunks);
+  const auto &output = cur_ctx->output_stats;
+  stats_report.counter("reused funcs", output.reused_funcs);
+  stats_report.counter("ir funcs", output.ir_funcs);
+  stats_report.counter("ir blocks", output.ir_blocks);
+  stats_report.counter("ir insts", output.ir_insts);
+  stats_report.counter("folded insts", cur_ctx->ir_builder.stats().folded);
+  const auto &m2r = cur_ctx->mem2reg.stats();
+  stats_report.counter("promoted vars", m2r.promoted);
+  stats_report.counter("removed loads", m2r.loads);
+  stats_report.counter("removed stores", m2r.stores);
+  stats_report.counter("block args", m2r.block_args);
+  stats_report.counter("split edges", m2r.split_edges);
+  const auto &gvn = cur_ctx->gvn.stats();
+  stats_report.counter("gvn exprs", gvn.exprs);
+  stats_report.counter("gvn loads", gvn.loads);
+  stats_report.counter("gvn folded", gvn.folded);
+  const auto &dce = cur_ctx->dce.stats();
+  stats_report.counter("dce blocks", dce.blocks);
+  stats_report.counter("dce insts", dce.insts);
+  stats_report.counter("dce allocs", dce.allocs);
+  stats_report.counter("dce stores", dce.stores);
+  stats_report.counter("dce block args", dce.block_args);
+  stats_report.counter("stack slots", cur_ctx->backend_stats.stack_slots);
+  stats_report.counter("riscv insts", cur_ctx->backend_stats.insts);
+  const auto &peep = cur_ctx->peephole.stats();
+  stats_report.counter("forwarded loads", peep.forwarded_loads);
+  stats_report.counter("dead stores", peep.dead_stores);
+  stats_report.counter("reused li", peep.reused_li);
+  stats_report.counter("coalesced moves", peep.coalesced_moves);
+  stats_report.counter("output bytes", output.bytes);
+}
+
+// 编译二进制 IR 格式的输入文件: 不需要 lexer 和 parser, 逐个读出函数交给 stream 生成代码
+static bool compile_ir(const char *mode, const char *input, const char *output) {
+  IRReader reader;
+  if(!reader.open(input)) {
+    fprintf(stderr, "%s: %s\n", input, reader.last_error().c_str());
+    return false;
+  }
+  int fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0) {
+    perror(output);
+    return false;
+  }
+  FunctionStream stream(mode, fd);
+  bool loaded = true;
+  bool written;
+  {
+    PhaseTimer timer("load");
+    auto &funcs = cur_ctx->ir_builder.program.funcs;
+    for(size_t i = 0; i < reader.func_num() && loaded; i ++) {
+      funcs.emplace_back();
+      loaded = reader.load(i, funcs.back());
+      if(loaded) {
+        stream.add_loaded();
+      }
+    }
+    written = loaded && stream.finish();
+  }
+  written = close(fd) == 0 && written;
+  if(!loaded) {
+    fprintf(stderr, "%s: %s\n", input, reader.last_error().c_str());
+  } else if(!written) {
+    perror(output);
+  }
+  if(!loaded || !written) {
+    unlink(output);
+    return false;
+  }
+  return true;
+}
+
+// 在当前的编译上下文中编译一个文件, 出错时返回 false, 并且删除输出文件
+// cache 不是 NULL 时使用函数级缓存, 只为上次编译以来改变了的函数生成 IR 和代码
+static bool compile(const char *mode, const char *input, const char *output, CompileCache *cache) {
+  if(IRReader::is_binary_ir(input)) {
+    return compile_ir(mode, input, output);
+  }
+
+  // 打开输入文件, 并且指定 lexer 在解析的时候读取这个文件
+  // 默认用 FastLexer 直接扫描映射进内存的文件, -lexer=flex 时改用 flex 生成的 lexer
+  Lexer lexer;
+  FastLexer fast;
+  FILE *in = NULL;
+  if(cur_ctx->flex_lexer) {
+    in = fopen(input, "r");
+    if(in == NULL) {
+      perror(input);
+      return false;
+    }
+    yylex_init(&lexer.scanner);
+    yyset_in(in, lexer.scanner);
+  } else {
+    if(!fast.open(input)) {
+      perror(input);
+      return false;
+    }
+    lexer.fast = &fast;
+  }
+
+  // 生成的代码边解析边写进输出文件
+  int fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0) {
+    perror(output);
+    if(in != NULL) {
+      yylex_destroy(lexer.scanner);
+      fclose(in);
+    }
+    return false;
+  }
+
+  // 调用 parser 函数, parser 函数会进一步调用 lexer 解析输入文件的
+  // 每解析完一个函数, stream 就生成它的 IR 和代码, 所以 irgen, mem2reg, codegen 和 write 都在 parse 之内
+  std::unique_ptr<FunctionCache> funcs;
+  if(cache != NULL) {
+    funcs = std::make_unique<FunctionCache>(*cache, mode, input);
+    lexer.record = true;
+  }
+  FunctionStream stream(mode, fd, funcs.get());
+  int ret;
+  bool written;
+  {
+    PhaseTimer timer("parse");
+    ret = yyparse(&lexer, &stream);
+    written = ret == 0 && stream.finish();
+  }
+  if(in != NULL) {
+    yylex_destroy(lexer.scanner);
+    fclose(in);
+  }
+  written = close(fd) == 0 && written;
+  if(ret) {
+    fprintf(stderr, "%s: failed to parse\n", input);
+  } else if(!written) {
+    perror(output);
+  }
+  // 不留下只有一部分函数的输出文件
+  if(ret || !written) {
+    unlink(output);
+    return false;
+  }
+  if(funcs != NULL) {
+    funcs->commit();
+  }
+  return true;
+}
+
+// 在新的编译上下文中完成一个编译任务, 可以在任何线程上调用
+// backend_threads 是后端同时生成各个函数时使用的线程数
+// flex_lexer 为 true 时用 flex 生成的 lexer
+// cache 不是 NULL 时先在缓存中查找, 没有命中时编译完再保存到缓存
+static void run_job(const char *mode, CompileJob &job, bool stats_json, bool flex_lexer, size_t backend_threads,
+                    CompileCache *cache) {
+  CompileContext ctx;
+  ctx.flex_lexer = flex_lexer;
+  ctx.backend_threads = backend_threads;
+  enter_context(&ctx);
+  {
+    PhaseTimer timer("total");
+    CacheKey key;
+    bool cacheable = false;
+    if(cache != NULL) {
+      PhaseTimer timer("cache lookup");
+      cacheable = cache->key(mode, job.input, key);
+      ctx.cache_hit = cacheable && cache->fetch(key, job.output);
+    }
+    if(ctx.cache_hit) {
+      job.ok = true;
+    } else {
+      job.ok = compile(mode, job.input, job.output, cache);
+      if(job.ok && cacheable) {
+        PhaseTimer timer("cache store");
+        cache->store(key, job.output);
+      }
+    }
+  }
+  if(job.ok && stats_enabled) {
+    collect_counters();
+    if(stats_json) {
+      ctx.stats_report.print_json(job.report);
+    } else {
+      ctx.stats_report.print_text(job.report);
+    }
+  }
+  enter_context(NULL);
+}
 
 int main(int argc, const char *argv[]) {
   // 解析命令行参数. 测试脚本/评测平台要求你的编译器能接收如下参数:
   // compiler 模式 输入文件 -o 输出文件
-  assert(argc == 5);
+  // 模式是 -koopa, -riscv 或 -ir (输出二进制格式的 IR); 输入文件也可以是 -ir 输出的二进制 IR, 这时跳过前端
+  // 之后还可以跟可选参数: -stats 在结束时向 stderr 输出每个阶段的耗时和统计信息, -stats=json 输出 JSON;
+  // -j 指定线程数 (默认是 CPU 核数), 后端用这些线程同时生成各个函数的代码;
+  // -lexer=flex 用 flex 生成的 lexer 代替默认的 FastLexer;
+  // -cache=目录 打开编译缓存, 输入文件和模式都相同时直接复制之前的输出, 否则只重新编译改变了的函数;
+  // -cache-limit=MB 是缓存的总大小上限
+  // 批量模式一次编译多个文件, 每个文件在线程池中单独编译, 这时 -j 是线程池的线程数:
+  // compiler 模式 -batch [-j 线程数] [-stats] 输入文件 -o 输出文件 输入文件 -o 输出文件 ...
+  assert(argc >= 5);
   auto mode = argv[1];
-  auto input = argv[2];
-  auto output = argv[4];
+  bool batch = strcmp(argv[2], "-batch") == 0;
+  size_t thread_num = std::thread::hardware_concurrency();
+  bool stats_json = false;
+  bool flex_lexer = false;
+  const char *cache_dir = NULL;
+  size_t cache_limit = CompileCache::DEFAULT_LIMIT;
+  std::vector<CompileJob> jobs;
+  int i = 2;
+  if(!batch) {
+    assert(strcmp(argv[3], "-o") == 0);
+    jobs.push_back(CompileJob{argv[2], argv[4]});
+    i = 5;
+  } else {
+    i = 3;
+  }
+  while(i < argc) {
+    if(strcmp(argv[i], "-stats") == 0) {
+      stats_enabled = true;
+    } else if(strcmp(argv[i], "-stats=json") == 0) {
+      stats_enabled = true;
+      stats_json = true;
+    } else if(strcmp(argv[i], "-lexer=flex") == 0) {
+      flex_lexer = true;
+    } else if(strncmp(argv[i], "-cache=", 7) == 0) {
+      cache_dir = argv[i] + 7;
+    } else if(strncmp(argv[i], "-cache-limit=", 13) == 0) {
+      cache_limit = (size_t)atoll(argv[i] + 13) << 20;
+    } else if(strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+      thread_num = atoi(argv[++ i]);
+    } else if(batch) {
+      assert(i + 2 < argc && strcmp(argv[i + 1], "-o") == 0);
+      jobs.push_back(CompileJob{argv[i], argv[i + 2]});
+      i += 2;
+    }
+    i ++;
+  }
 
-  // 打开输入文件, 并且指定 lexer 在解析的时候读取这个文件
-  yyin = fopen(input, "r");
-  assert(yyin);
+  std::unique_ptr<CompileCache> cache;
+  if(cache_dir != NULL) {
+    cache = std::make_unique<CompileCache>(cache_dir, cache_limit);
+  }
 
-  // 调用 parser 函数, parser 函数会进一步调用 lexer 解析输入文件的
-  unique_ptr<BaseAST> ast;
-  auto ret = yyparse(ast);
-  assert(!ret);
-
-  if(strcmp(mode, "-koopa") == 0) {
-    freopen(output,"w",stdout);
-    ast->Dump();
-    fclose(stdout);
-  } else if(strcmp(mode, "-riscv") == 0) {
-    freopen("debug/qaz.tmp", "w", stdout); // .tmp 为中间文件
-    ast->Dump();
-    fclose(stdout);
-    FILE *fp = fopen("debug/qaz.tmp", "r");
-    char *buf = (char *)malloc(100000);
-    fread(buf, 1, 100000, fp);
-    freopen(output, "w", stdout);
-    parse_string_to_koopa(buf);
-    fclose(stdout);
-  }
-  return 0;
+  // 多个文件同时编译时已经用满了所有线程, 每个文件的后端就不再创建线程
+  if(jobs.size() == 1 || thread_num <= 1) {
+    for(auto &job : jobs) {
+      run_job(mode, job, stats_json, flex_lexer, thread_num, cache.get());
+    }
+  } else {
+    ThreadPool pool(std::min(thread_num, jobs.size()));
+    for(auto &job : jobs) {
+      pool.submit([&, mode, stats_json, flex_lexer] {
+        run_job(mode, job, stats_json, flex_lexer, 1, cache.get());
+      });
+    }
+    pool.wait();
+  }
+
+  // 报告按输入文件的顺序输出, 批量模式下每个报告前面加上文件名, JSON 的报告放在一个数组里
+  bool ok = true;
+  std::string reports;
+  for(size_t k = 0; k < jobs.size(); k ++) {
+    ok &= jobs[k].ok;
+    if(!stats_enabled || !jobs[k].ok) {
+      continue;
+    }
+    if(!batch) {
+      reports += jobs[k].report;
+    } else if(stats_json) {
+      reports += reports.empty() ? "[\n" : ",\n";
+      reports += jobs[k].report;
+    } else {
+      reports += "== " + std::string(jobs[k].input) + " ==\n" + jobs[k].report + "\n";
+    }
+  }
+  if(batch && stats_json && !reports.empty()) {
+    reports += "\n]";
+  }
+  if(stats_json && !reports.empty()) {
+    reports += '\n';
+  }
+  fputs(reports.c_str(), stderr);
+  return ok ? 0 : 1;
 }
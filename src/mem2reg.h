@@ -0,0 +1,365 @@
+// mem2reg: 把局部变量从栈上 (alloc/load/store) 提升为 SSA 形式的值
+// 按 Cytron 等人的方法: 在写入变量的基本块的迭代支配边界上放置基本块参数 (相当于 phi),
+// 再沿着支配树把每个 load 替换成当前可见的值, 把 store 的值作为之后的当前值
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include "cfg.h"
+#include "ir.h"
+
+class Mem2Reg {
+  public:
+    struct Stats {
+      // 被提升的变量个数
+      size_t promoted = 0;
+      // 删除的 load/store 条数
+      size_t loads = 0;
+      size_t stores = 0;
+      // 最终保留下来的基本块参数个数
+      size_t block_args = 0;
+      // 为了传递基本块参数而拆开的关键边条数
+      size_t split_edges = 0;
+    };
+
+    void run(IRProgram &program) {
+      for(auto &func : program.funcs) {
+        run(func);
+      }
+    }
+
+    void run(IRFunction &func) {
+      int n = func.insts.size();
+      // 只有 load/store 访问的 alloc 才能提升; 目前所有变量都满足, 以后有了取地址的操作就不一定了
+      std::vector<bool> promote(n);
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.insts) {
+          if(func.insts[id].tag == IR_ALLOC) {
+            promote[id] = true;
+          }
+        }
+      }
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.insts) {
+          for_each_use(func, func.insts[id], [&](int v) {
+            promote[v] = false;
+          });
+        }
+      }
+      for(bool p : promote) {
+        stats_.promoted += p;
+      }
+
+      std::vector<int> param_var = place_params(func, promote);
+      split_critical_edges(func);
+      rename(func, promote, param_var);
+      prune_params(func);
+    }
+
+    const Stats &stats() const {
+      return stats_;
+    }
+
+  private:
+    Stats stats_;
+
+    // 在需要合并不同定值的基本块上添加参数, 返回每个参数对应的变量 (下标是指令编号)
+    std::vector<int> place_params(IRFunction &func, const std::vector<bool> &promote) {
+      int n = func.insts.size();
+      int nbb = func.bbs.size();
+      CFG cfg = build_cfg(func);
+      std::vector<std::vector<int>> df = dominance_frontiers(func, cfg);
+
+      // 写入变量的基本块, 以及变量是否在某个基本块中先读后写 (只有这样的变量需要参数, 即 semi-pruned SSA)
+      std::vector<std::vector<int>> def_blocks(n);
+      std::vector<bool> global(n);
+      std::vector<int> stamp(n, -1);
+      for(int b = 0; b < nbb; b ++) {
+        for(int id : func.bbs[b].insts) {
+          const IRInst &inst = func.insts[id];
+          if(inst.tag == IR_LOAD && promote[inst.data.load.src] && stamp[inst.data.load.src] != b) {
+            global[inst.data.load.src] = true;
+          } else if(inst.tag == IR_STORE && promote[inst.data.store.dest] && stamp[inst.data.store.dest] != b) {
+            stamp[inst.data.store.dest] = b;
+            def_blocks[inst.data.store.dest].push_back(b);
+          }
+        }
+      }
+
+      std::vector<int> param_var(n, -1);
+      std::vector<int> placed(nbb, -1), queued(nbb, -1);
+      for(int v = 0; v < n; v ++) {
+        if(!promote[v] || !global[v]) {
+          continue;
+        }
+        std::vector<int> work = def_blocks[v];
+        for(int b : work) {
+          queued[b] = v;
+        }
+        while(!work.empty()) {
+          int b = work.back();
+          work.pop_back();
+          for(int d : df[b]) {
+            if(placed[d] == v) {
+              continue;
+            }
+            placed[d] = v;
+            IRInst arg;
+            arg.tag = IR_BLOCK_ARG;
+            func.insts.push_back(arg);
+            func.bbs[d].params.push_back(func.insts.size() - 1);
+            param_var.push_back(v);
+            if(queued[d] != v) {
+              queued[d] = v;
+              work.push_back(d);
+            }
+          }
+        }
+      }
+      return param_var;
+    }
+
+    // br 不能传递参数, 所以 br 跳到带参数的基本块时 (这样的边一定是关键边), 在中间插入一个只有 jump 的基本块
+    // 新的基本块紧跟在 br 所在的基本块之后, 尽量让其中一个分支可以直接顺序执行下去
+    void split_critical_edges(IRFunction &func) {
+      int nbb = func.bbs.size();
+      std::vector<bool> has_params(nbb);
+      for(int b = 0; b < nbb; b ++) {
+        has_params[b] = !func.bbs[b].params.empty();
+      }
+      // 新的基本块顺序, 以及原来的基本块的新下标
+      std::vector<IRBasicBlock> bbs;
+      std::vector<int> new_index(nbb);
+      int count = 0;
+      for(int b = 0; b < nbb; b ++) {
+        new_index[b] = bbs.size();
+        bbs.push_back(std::move(func.bbs[b]));
+        if(bbs.back().insts.empty()) {
+          continue;
+        }
+        int br = bbs.back().insts.back();
+        if(func.insts[br].tag != IR_BRANCH) {
+          continue;
+        }
+        for(int k = 0; k < 2; k ++) {
+          int target = k == 0 ? func.insts[br].data.branch.true_bb : func.insts[br].data.branch.false_bb;
+          if(!has_params[target]) {
+            continue;
+          }
+          IRInst jump;
+          jump.tag = IR_JUMP;
+          jump.data.jump.target = target;
+          jump.data.jump.args = 0;
+          jump.data.jump.arg_num = 0;
+          func.insts.push_back(jump);
+          IRBasicBlock split;
+          split.name = "split_" + std::to_string(count ++);
+          split.insts.push_back(func.insts.size() - 1);
+          // 先记下插入的基本块的新下标, 取负数和原来的下标区分开
+          IRBranch &branch = func.insts[br].data.branch;
+          (k == 0 ? branch.true_bb : branch.false_bb) = -1 - (int)bbs.size();
+          bbs.push_back(std::move(split));
+          stats_.split_edges ++;
+        }
+      }
+      if(count == 0) {
+        func.bbs = std::move(bbs);
+        return;
+      }
+      auto remap = [&](int &target) {
+        target = target < 0 ? -1 - target : new_index[target];
+      };
+      for(auto &bb : bbs) {
+        if(bb.insts.empty()) {
+          continue;
+        }
+        IRInst &last = func.insts[bb.insts.back()];
+        if(last.tag == IR_BRANCH) {
+          remap(last.data.branch.true_bb);
+          remap(last.data.branch.false_bb);
+        } else if(last.tag == IR_JUMP) {
+          remap(last.data.jump.target);
+        }
+      }
+      func.bbs = std::move(bbs);
+    }
+
+    // 沿着支配树重命名: 删除被提升变量的 alloc/load/store, 把 load 的结果替换成变量的当前值,
+    // 并在每个 jump 上传递目标基本块参数对应的变量的当前值
+    void rename(IRFunction &func, const std::vector<bool> &promote, const std::vector<int> &param_var) {
+      int nbb = func.bbs.size();
+      CFG cfg = build_cfg(func);
+      // load 被替换成的值, kind 为 NONE 表示没有被替换
+      std::vector<IROperand> repl(func.insts.size(), IROperand{IROperand::NONE, 0});
+      // 每个变量的当前值组成的栈, 栈为空表示变量还没有被赋值 (读到的值是未定义的, 用 0 代替)
+      std::vector<std::vector<IROperand>> stacks(promote.size());
+      auto current = [&](int v) {
+        return stacks[v].empty() ? ir_integer(0) : stacks[v].back();
+      };
+      auto resolve = [&](IROperand &opr) {
+        if(opr.kind == IROperand::VALUE && repl[opr.val].kind != IROperand::NONE) {
+          opr = repl[opr.val];
+        }
+      };
+
+      // 处理一个基本块, 把压入栈的变量记在 pushed 中, 离开支配子树时弹出
+      auto visit = [&](int b, std::vector<int> &pushed) {
+        IRBasicBlock &bb = func.bbs[b];
+        for(int p : bb.params) {
+          stacks[param_var[p]].push_back(ir_value(p));
+          pushed.push_back(param_var[p]);
+        }
+        std::vector<int> insts;
+        for(int id : bb.insts) {
+          IRInst &inst = func.insts[id];
+          switch(inst.tag) {
+            case IR_ALLOC:
+              if(promote[id]) {
+                continue;
+              }
+              break;
+            case IR_LOAD:
+              if(promote[inst.data.load.src]) {
+                repl[id] = current(inst.data.load.src);
+                stats_.loads ++;
+                continue;
+              }
+              break;
+            case IR_STORE:
+              resolve(inst.data.store.value);
+              if(promote[inst.data.store.dest]) {
+                stacks[inst.data.store.dest].push_back(inst.data.store.value);
+                pushed.push_back(inst.data.store.dest);
+                stats_.stores ++;
+                continue;
+              }
+              break;
+            case IR_BINARY:
+              resolve(inst.data.binary.lhs);
+              resolve(inst.data.binary.rhs);
+              break;
+            case IR_BRANCH:
+              resolve(inst.data.branch.cond);
+              break;
+            case IR_JUMP: {
+              const auto &params = func.bbs[inst.data.jump.target].params;
+              inst.data.jump.args = func.jump_args.size();
+              inst.data.jump.arg_num = params.size();
+              for(int p : params) {
+                func.jump_args.push_back(current(param_var[p]));
+              }
+              break;
+            }
+            case IR_RETURN:
+              resolve(inst.data.ret.value);
+              break;
+            default:
+              break;
+          }
+          insts.push_back(id);
+        }
+        bb.insts = std::move(insts);
+      };
+
+      // 非递归地遍历支配树
+      std::vector<bool> done(nbb);
+      std::vector<std::pair<int, size_t>> stack;
+      std::vector<std::vector<int>> pushed(nbb);
+      auto enter = [&](int b) {
+        done[b] = true;
+        visit(b, pushed[b]);
+        stack.emplace_back(b, 0);
+      };
+      for(int root = 0; root < nbb; root ++) {
+        // 不可达的基本块单独处理, 其中所有变量都是未定义的
+        if(done[root] || (root != 0 && cfg.reachable(root))) {
+          continue;
+        }
+        enter(root);
+        while(!stack.empty()) {
+          int b = stack.back().first;
+          size_t &next = stack.back().second;
+          if(cfg.reachable(b) && next < cfg.children[b].size()) {
+            enter(cfg.children[b][next ++]);
+            continue;
+          }
+          for(int v : pushed[b]) {
+            stacks[v].pop_back();
+          }
+          stack.pop_back();
+        }
+      }
+    }
+
+    // 删除值没有被用到的基本块参数, 以及 jump 上对应的参数
+    // 参数只被用作其他 (没有用到的) 参数的值时也算没有用到, 所以从真正的使用出发沿着 jump 反向标记
+    void prune_params(IRFunction &func) {
+      int nbb = func.bbs.size();
+      int n = func.insts.size();
+      // 参数所在的基本块和它是第几个参数
+      std::vector<int> owner(n, -1), index(n, -1);
+      for(int b = 0; b < nbb; b ++) {
+        for(int i = 0; i < (int)func.bbs[b].params.size(); i ++) {
+          owner[func.bbs[b].params[i]] = b;
+          index[func.bbs[b].params[i]] = i;
+        }
+      }
+      // 跳到每个基本块的 jump
+      std::vector<std::vector<int>> jumps(nbb);
+      std::vector<bool> used(n);
+      std::vector<int> work;
+      auto mark = [&](int v) {
+        if(owner[v] != -1 && !used[v]) {
+          used[v] = true;
+          work.push_back(v);
+        }
+      };
+      for(const auto &bb : func.bbs) {
+        for(int id : bb.insts) {
+          const IRInst &inst = func.insts[id];
+          if(inst.tag == IR_JUMP) {
+            jumps[inst.data.jump.target].push_back(id);
+          } else {
+            for_each_use(func, inst, mark);
+          }
+        }
+      }
+      while(!work.empty()) {
+        int p = work.back();
+        work.pop_back();
+        for(int id : jumps[owner[p]]) {
+          const IROperand &arg = func.jump_args[func.insts[id].data.jump.args + index[p]];
+          if(arg.kind == IROperand::VALUE) {
+            mark(arg.val);
+          }
+        }
+      }
+
+      for(int b = 0; b < nbb; b ++) {
+        auto &params = func.bbs[b].params;
+        std::vector<int> kept;
+        for(int p : params) {
+          if(used[p]) {
+            kept.push_back(p);
+          }
+        }
+        if(kept.size() != params.size()) {
+          // 参数在 jump_args 中是连续存放的, 原地去掉没用的那些
+          for(int id : jumps[b]) {
+            IRJump &jump = func.insts[id].data.jump;
+            int k = 0;
+            for(int i = 0; i < jump.arg_num; i ++) {
+              if(used[params[i]]) {
+                func.jump_args[jump.args + k ++] = func.jump_args[jump.args + i];
+              }
+            }
+            jump.arg_num = k;
+          }
+          params = std::move(kept);
+        }
+        stats_.block_args += params.size();
+      }
+    }
+};
@@ -0,0 +1,266 @@
+// RISC-V 指令列表上的窥孔优化
+// 后端逐条翻译 IR 时只看得到当前这条指令, 会留下很多冗余的 lw/sw/li/mv, 在输出之前统一清理
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "riscv.h"
+
+class Peephole {
+  public:
+    // 每条规则生效的次数
+    struct Stats {
+      // 从刚写入的栈位置读取, 改成 mv 或者直接删掉的 lw
+      size_t forwarded_loads = 0;
+      // 写入之后不会再被读取, 被删掉的 sw
+      size_t dead_stores = 0;
+      // 寄存器里已经是这个常量, 被删掉的 li
+      size_t reused_li = 0;
+      // 和前一条指令合并掉的 mv
+      size_t coalesced_moves = 0;
+    };
+
+    // 优化一个函数的指令列表, 直到没有规则可以再应用
+    void run(std::vector<RVInst> &code) {
+      bool changed = true;
+      while(changed) {
+        changed = forward(code);
+        changed |= remove_dead_stores(code);
+        changed |= coalesce_moves(code);
+      }
+    }
+
+    const Stats &stats() const {
+      return stats_;
+    }
+
+    // 把另一个实例 (例如在其他线程上优化别的函数的实例) 的统计累加进来
+    void merge(const Stats &other) {
+      stats_.forwarded_loads += other.forwarded_loads;
+      stats_.dead_stores += other.dead_stores;
+      stats_.reused_li += other.reused_li;
+      stats_.coalesced_moves += other.coalesced_moves;
+    }
+
+  private:
+    Stats stats_;
+
+    // 删除 dead 标记的指令, 返回是否删除了指令
+    static bool compact(std::vector<RVInst> &code, const std::vector<bool> &dead) {
+      size_t n = 0;
+      for(size_t i = 0; i < code.size(); i ++) {
+        if(!dead[i]) {
+          code[n ++] = code[i];
+        }
+      }
+      bool changed = n != code.size();
+      code.resize(n);
+      return changed;
+    }
+
+    // 按顺序记录每个栈位置和寄存器中的内容:
+    // 栈位置的值已经在某个寄存器里时, lw 改成 mv (目的寄存器就是这个寄存器时直接删掉);
+    // 把刚从某个栈位置读出来的寄存器写回同一个位置时, 删掉 sw;
+    // 寄存器里已经是要 li 的常量时, 删掉 li
+    // 标号处可能从别的地方跳过来, 所有信息都作废
+    bool forward(std::vector<RVInst> &code) {
+      std::vector<bool> dead(code.size());
+      // (栈偏移量, 保存着同样的值的寄存器)
+      std::vector<std::pair<int, int>> slots;
+      bool known[RV_REG_NUM] = {};
+      int value[RV_REG_NUM];
+      // x0 永远是 0
+      known[RV_X0] = true;
+      value[RV_X0] = 0;
+      auto kill_reg = [&](int r) {
+        known[r] = false;
+        for(size_t k = 0; k < slots.size(); k ++) {
+          if(slots[k].second == r) {
+            slots[k] = slots.back();
+            slots.pop_back();
+            k --;
+          }
+        }
+      };
+      auto kill_slot = [&](int offset) {
+        for(size_t k = 0; k < slots.size(); k ++) {
+          if(slots[k].first == offset) {
+            slots[k] = slots.back();
+            slots.pop_back();
+            k --;
+          }
+        }
+      };
+      for(size_t i = 0; i < code.size(); i ++) {
+        RVInst &inst = code[i];
+        if(inst.op == RV_LABEL) {
+          slots.clear();
+          for(int r = RV_X0 + 1; r < RV_REG_NUM; r ++) {
+            known[r] = false;
+          }
+          continue;
+        }
+        if(inst.op == RV_LW && inst.rs1 == RV_SP) {
+          int holder = -1;
+          for(const auto &slot : slots) {
+            if(slot.first == inst.imm) {
+              holder = slot.second;
+            }
+          }
+          if(holder == inst.rd) {
+            dead[i] = true;
+            stats_.forwarded_loads ++;
+            continue;
+          }
+          int offset = inst.imm;
+          if(holder != -1) {
+            inst = rv_inst(RV_MV, inst.rd, holder, -1, -1);
+            stats_.forwarded_loads ++;
+          }
+          kill_reg(inst.rd);
+          if(holder != -1 && known[holder]) {
+            known[inst.rd] = true;
+            value[inst.rd] = value[holder];
+          }
+          slots.emplace_back(offset, inst.rd);
+          continue;
+        }
+        if(inst.op == RV_SW) {
+          if(inst.rs1 == RV_SP) {
+            bool same = false;
+            for(const auto &slot : slots) {
+              same |= slot.first == inst.imm && slot.second == inst.rs2;
+            }
+            if(same) {
+              dead[i] = true;
+              stats_.dead_stores ++;
+              continue;
+            }
+            kill_slot(inst.imm);
+            slots.emplace_back(inst.imm, inst.rs2);
+          } else {
+            // 不知道写到了哪里
+            slots.clear();
+          }
+          continue;
+        }
+        if(inst.op == RV_LI) {
+          if(known[inst.rd] && value[inst.rd] == inst.imm) {
+            dead[i] = true;
+            stats_.reused_li ++;
+            continue;
+          }
+          kill_reg(inst.rd);
+          known[inst.rd] = true;
+          value[inst.rd] = inst.imm;
+          continue;
+        }
+        int rd = rv_def(inst);
+        if(rd == RV_SP) {
+          // sp 变了, 之前记录的偏移量都不对了
+          slots.clear();
+        }
+        if(rd != -1) {
+          bool copy = inst.op == RV_MV && known[inst.rs1];
+          int val = copy ? value[inst.rs1] : 0;
+          kill_reg(rd);
+          known[rd] = copy;
+          value[rd] = val;
+        }
+      }
+      return compact(code, dead);
+    }
+
+    // 删除不会被读取的 sw:
+    // 整个函数中都没有 lw 读过的栈位置, 写入它的 sw 都可以删掉;
+    // 同一个基本块中, 两次写入同一个位置之间没有读取时, 前一次写入可以删掉
+    bool remove_dead_stores(std::vector<RVInst> &code) {
+      std::vector<bool> dead(code.size());
+      std::vector<int> loaded;
+      bool unknown_load = false;
+      for(const auto &inst : code) {
+        if(inst.op == RV_LW) {
+          if(inst.rs1 == RV_SP) {
+            loaded.push_back(inst.imm);
+          } else {
+            unknown_load = true;
+          }
+        }
+      }
+      std::unordered_map<int, bool> is_loaded;
+      for(int offset : loaded) {
+        is_loaded[offset] = true;
+      }
+      // 还没有被读取过的 sw: 栈偏移量 -> 指令下标
+      std::unordered_map<int, size_t> pending;
+      for(size_t i = 0; i < code.size(); i ++) {
+        const RVInst &inst = code[i];
+        if(inst.op == RV_SW && inst.rs1 == RV_SP) {
+          if(!unknown_load && !is_loaded.count(inst.imm)) {
+            dead[i] = true;
+            continue;
+          }
+          auto it = pending.find(inst.imm);
+          if(it != pending.end()) {
+            dead[it->second] = true;
+          }
+          pending[inst.imm] = i;
+        } else if(inst.op == RV_LW) {
+          if(inst.rs1 == RV_SP) {
+            pending.erase(inst.imm);
+          } else {
+            pending.clear();
+          }
+        } else if(inst.op >= RV_BEQZ || rv_def(inst) == RV_SP) {
+          // 离开基本块, 或者 sp 变了
+          pending.clear();
+        }
+      }
+      for(bool d : dead) {
+        stats_.dead_stores += d;
+      }
+      return compact(code, dead);
+    }
+
+    // 删除 mv r, r; 如果 mv d, s 的前一条指令写入 s, 并且 s 之后不再被读取, 让前一条指令直接写入 d
+    // 从后往前做活跃分析, 跳转处保守地认为除了临时寄存器 t0-t2 之外都是活跃的
+    // (临时寄存器只在一条 IR 指令的翻译结果内部使用, 不会跨越基本块)
+    bool coalesce_moves(std::vector<RVInst> &code) {
+      const uint32_t all_live = ~((1u << RV_T0) | (1u << RV_T1) | (1u << RV_T2));
+      std::vector<bool> dead(code.size());
+      uint32_t live = 0;
+      for(int i = (int)code.size() - 1; i >= 0; i --) {
+        RVInst &inst = code[i];
+        if(inst.op == RV_J || inst.op == RV_BEQZ || inst.op == RV_BNEZ) {
+          live = all_live;
+        } else if(inst.op == RV_RET) {
+          live = 0;
+        }
+        if(inst.op == RV_MV) {
+          if(inst.rd == inst.rs1) {
+            dead[i] = true;
+            stats_.coalesced_moves ++;
+            continue;
+          }
+          int s = inst.rs1;
+          if(i > 0 && s != RV_X0 && s != RV_SP && rv_def(code[i - 1]) == s && !(live >> s & 1)) {
+            code[i - 1].rd = inst.rd;
+            dead[i] = true;
+            stats_.coalesced_moves ++;
+            continue;
+          }
+        }
+        int rd = rv_def(inst);
+        if(rd != -1) {
+          live &= ~(1u << rd);
+        }
+        rv_for_each_use(inst, [&](int r) {
+          live |= 1u << r;
+        });
+      }
+      return compact(code, dead);
+    }
+};
@@ -0,0 +1,246 @@
+// 活跃变量分析和线性扫描寄存器分配
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "cfg.h"
+#include "ir.h"
+#include "riscv.h"
+
+// 可以分配给 IR 值的寄存器, 按优先顺序排列
+// t0/t1/t2 保留给后端做临时寄存器 (溢出的操作数, 立即数, 大偏移量的地址),
+// 没有函数调用, 所以 a1-a7 也可以随便用; s0-s11 是 callee-saved, 用到时需要在 prologue 中保存
+static const int alloc_regs[] = {
+  RV_T3, RV_T4, RV_T5, RV_T6,
+  RV_A1, RV_A2, RV_A3, RV_A4, RV_A5, RV_A6, RV_A7,
+  RV_S0, RV_S1, RV_S2, RV_S3, RV_S4, RV_S5, RV_S6, RV_S7, RV_S8, RV_S9, RV_S10, RV_S11,
+};
+static const int ALLOC_REG_NUM = sizeof(alloc_regs) / sizeof(alloc_regs[0]);
+// alloc_regs 中第一个 callee-saved 寄存器的下标
+static const int FIRST_CALLEE_SAVED = 11;
+
+// 值的活跃区间 [start, end], 端点是指令在线性顺序中的位置, def 是定义这个值的指令的位置
+struct LiveInterval {
+  int value;
+  int start;
+  int end;
+  int def;
+};
+
+// 需要放进寄存器的值: 有返回值, 并且不是 alloc (alloc 表示栈上的变量)
+inline bool is_reg_value(const IRInst &inst) {
+  return ir_has_value(inst) && inst.tag != IR_ALLOC;
+}
+
+// 对指令 inst 访问的每个变量调用 f(变量, 是否是定值)
+// 变量包括放在寄存器中的值和栈上的 alloc: 有返回值的指令定义它自己, load 使用它读取的 alloc,
+// store 定义它写入的 alloc (store 会覆盖整个变量, 所以算作定值)
+template<typename F>
+void for_each_access(const IRFunction &func, int id, const IRInst &inst, F f) {
+  for_each_use(func, inst, [&](int v) {
+    f(v, false);
+  });
+  if(inst.tag == IR_LOAD) {
+    f(inst.data.load.src, false);
+  } else if(inst.tag == IR_STORE) {
+    f(inst.data.store.dest, true);
+  }
+  if(is_reg_value(inst)) {
+    f(id, true);
+  }
+}
+
+// 把区间按起点排序
+inline std::vector<LiveInterval> sort_intervals(const IRFunction &func, const std::vector<int> &start,
+                                                const std::vector<int> &end, const std::vector<int> &pos) {
+  std::vector<LiveInterval> intervals;
+  for(int id = 0; id < (int)func.insts.size(); id ++) {
+    if(start[id] != -1) {
+      intervals.push_back(LiveInterval{id, start[id], end[id], pos[id]});
+    }
+  }
+  std::sort(intervals.begin(), intervals.end(), [](const LiveInterval &a, const LiveInterval &b) {
+    return a.start < b.start || (a.start == b.start && a.value < b.value);
+  });
+  return intervals;
+}
+
+// 计算每个变量 (寄存器中的值和 alloc) 的活跃区间
+// 先在基本块之间迭代求出 live-in/live-out 集合, 再按线性顺序把每个变量的区间扩展到覆盖所有活跃的位置
+// 区间总是包含变量所有的定值和使用位置; 只在一个基本块中访问的变量不会跨越基本块, 数据流分析只需要考虑其余的变量
+inline std::vector<LiveInterval> build_intervals(const IRFunction &func) {
+  int n = func.insts.size();
+  int nbb = func.bbs.size();
+  // 基本块的起止位置, 以及每条指令的位置
+  // 基本块参数在基本块开头各占一个位置, 它们同时被赋值, 不能互相复用寄存器
+  std::vector<int> bb_start(nbb), bb_end(nbb), pos(n, -1);
+  int p = 0;
+  for(int b = 0; b < nbb; b ++) {
+    bb_start[b] = p;
+    for(int id : func.bbs[b].params) {
+      pos[id] = p ++;
+    }
+    for(int id : func.bbs[b].insts) {
+      pos[id] = p ++;
+    }
+    bb_end[b] = p - 1;
+  }
+
+  std::vector<int> start(n, -1), end(n, -1);
+  // 跨越基本块的变量, 重新编号为 0, 1, ... 作为位集合的下标
+  std::vector<int> first_block(n, -1), global_id(n, -1), global_value;
+  for(int b = 0; b < nbb; b ++) {
+    for(int id : func.bbs[b].params) {
+      start[id] = end[id] = pos[id];
+      first_block[id] = b;
+    }
+    for(int id : func.bbs[b].insts) {
+      for_each_access(func, id, func.insts[id], [&](int v, bool) {
+        start[v] = start[v] == -1 ? pos[id] : std::min(start[v], pos[id]);
+        end[v] = std::max(end[v], pos[id]);
+        if(first_block[v] == -1) {
+          first_block[v] = b;
+        } else if(first_block[v] != b && global_id[v] == -1) {
+          global_id[v] = global_value.size();
+          global_value.push_back(v);
+        }
+      });
+    }
+  }
+  if(global_value.empty()) {
+    return sort_intervals(func, start, end, pos);
+  }
+
+  int words = (global_value.size() + 63) / 64;
+  typedef std::vector<uint64_t> Bits;
+  std::vector<Bits> use(nbb, Bits(words)), def(nbb, Bits(words));
+  std::vector<Bits> live_in(nbb, Bits(words)), live_out(nbb, Bits(words));
+  for(int b = 0; b < nbb; b ++) {
+    for(int id : func.bbs[b].params) {
+      int g = global_id[id];
+      if(g != -1) {
+        def[b][g / 64] |= 1ull << (g % 64);
+      }
+    }
+    for(int id : func.bbs[b].insts) {
+      // 同一条指令中先使用后定值
+      for(int pass = 0; pass < 2; pass ++) {
+        for_each_access(func, id, func.insts[id], [&](int v, bool is_def) {
+          int g = global_id[v];
+          if(g == -1 || is_def != (pass == 1)) {
+            return;
+          }
+          if(is_def) {
+            def[b][g / 64] |= 1ull << (g % 64);
+          } else if(!(def[b][g / 64] >> (g % 64) & 1)) {
+            use[b][g / 64] |= 1ull << (g % 64);
+          }
+        });
+      }
+    }
+  }
+  bool changed = true;
+  while(changed) {
+    changed = false;
+    for(int b = nbb - 1; b >= 0; b --) {
+      for(int s : successors(func, func.bbs[b])) {
+        for(int w = 0; w < words; w ++) {
+          live_out[b][w] |= live_in[s][w];
+        }
+      }
+      for(int w = 0; w < words; w ++) {
+        uint64_t in = use[b][w] | (live_out[b][w] & ~def[b][w]);
+        if(in != live_in[b][w]) {
+          live_in[b][w] = in;
+          changed = true;
+        }
+      }
+    }
+  }
+
+  for(int b = 0; b < nbb; b ++) {
+    for(int g = 0; g < (int)global_value.size(); g ++) {
+      int v = global_value[g];
+      if(live_in[b][g / 64] >> (g % 64) & 1) {
+        start[v] = std::min(start[v], bb_start[b]);
+      }
+      if(live_out[b][g / 64] >> (g % 64) & 1) {
+        end[v] = std::max(end[v], bb_end[b]);
+      }
+    }
+  }
+  return sort_intervals(func, start, end, pos);
+}
+
+// 线性扫描寄存器分配 (Poletto & Sarkar)
+// 返回每个值分到的寄存器在 alloc_regs 中的下标, -1 表示没有分到寄存器 (溢出到栈上, 或者不需要寄存器)
+// 一个值的区间在某条指令处结束时, 它的寄存器可以直接给这条指令的结果用,
+// 所以后端为一条指令生成的序列必须在读完源操作数之后才能写目的寄存器
+inline std::vector<int> linear_scan(const IRFunction &func, const std::vector<LiveInterval> &intervals) {
+  std::vector<int> reg(func.insts.size(), -1);
+  std::vector<bool> free_reg(ALLOC_REG_NUM, true);
+  // 正在占用寄存器的区间, 按结束位置排序
+  std::vector<LiveInterval> active;
+  auto by_end = [](const LiveInterval &a, const LiveInterval &b) {
+    return a.end < b.end;
+  };
+  for(const auto &cur : intervals) {
+    if(!is_reg_value(func.insts[cur.value])) {
+      continue;
+    }
+    // 释放已经结束的区间占用的寄存器
+    // 区间恰好在 cur 的定义处结束时, 它是这条指令的操作数, 寄存器可以留给结果
+    while(!active.empty() && (active.front().end < cur.start ||
+                              (active.front().end == cur.start && cur.def == cur.start))) {
+      free_reg[reg[active.front().value]] = true;
+      active.erase(active.begin());
+    }
+    int r = std::find(free_reg.begin(), free_reg.end(), true) - free_reg.begin();
+    if(r < ALLOC_REG_NUM) {
+      free_reg[r] = false;
+      reg[cur.value] = r;
+      active.insert(std::upper_bound(active.begin(), active.end(), cur, by_end), cur);
+    } else if(active.back().end > cur.end) {
+      // 没有空闲的寄存器, 溢出结束得最晚的区间
+      LiveInterval spill = active.back();
+      active.pop_back();
+      reg[cur.value] = reg[spill.value];
+      reg[spill.value] = -1;
+      active.insert(std::upper_bound(active.begin(), active.end(), cur, by_end), cur);
+    }
+  }
+  return reg;
+}
+
+// 给栈上的变量 (alloc 和溢出的值) 分配栈帧中的位置
+// 活跃区间不重叠的变量可以共用同一个 4 字节的位置, 区间按起点排好序, 所以贪心地复用最早空出来的位置就是最优的
+// 返回每个变量的位置编号 (-1 表示不在栈上), slot_num 是用到的位置个数
+inline std::vector<int> color_stack_slots(const IRFunction &func, const std::vector<LiveInterval> &intervals,
+                                          const std::vector<int> &reg, int &slot_num) {
+  std::vector<int> slot(func.insts.size(), -1);
+  std::vector<int> free_slots;
+  // 占用着位置的区间, 按结束位置排序
+  std::vector<LiveInterval> active;
+  auto by_end = [](const LiveInterval &a, const LiveInterval &b) {
+    return a.end < b.end;
+  };
+  slot_num = 0;
+  for(const auto &cur : intervals) {
+    if(reg[cur.value] != -1) {
+      continue;
+    }
+    while(!active.empty() && active.front().end < cur.start) {
+      free_slots.push_back(slot[active.front().value]);
+      active.erase(active.begin());
+    }
+    if(free_slots.empty()) {
+      slot[cur.value] = slot_num ++;
+    } else {
+      slot[cur.value] = free_slots.back();
+      free_slots.pop_back();
+    }
+    active.insert(std::upper_bound(active.begin(), active.end(), cur, by_end), cur);
+  }
+  return slot;
+}
@@ -0,0 +1,170 @@
+// 内存中的 RISC-V 指令
+// 后端先把一个函数翻译成指令列表, 经过窥孔优化之后再输出成汇编文本
+#pragma once
+
+#include <string>
+#include <vector>
+#include "emitter.h"
+
+// 寄存器, 按 x0-x31 的编号排列
+enum RVReg {
+  RV_X0, RV_RA, RV_SP, RV_GP, RV_TP, RV_T0, RV_T1, RV_T2,
+  RV_S0, RV_S1, RV_A0, RV_A1, RV_A2, RV_A3, RV_A4, RV_A5,
+  RV_A6, RV_A7, RV_S2, RV_S3, RV_S4, RV_S5, RV_S6, RV_S7,
+  RV_S8, RV_S9, RV_S10, RV_S11, RV_T3, RV_T4, RV_T5, RV_T6,
+  RV_REG_NUM,
+};
+
+static const char *const rv_reg_name[] = {
+  "x0", "ra", "sp", "gp", "tp", "t0", "t1", "t2",
+  "s0", "s1", "a0", "a1", "a2", "a3", "a4", "a5",
+  "a6", "a7", "s2", "s3", "s4", "s5", "s6", "s7",
+  "s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6",
+};
+
+// 指令种类, 注释是汇编中的格式
+enum RVOp {
+  RV_LI,     // li    rd, imm
+  RV_MV,     // mv    rd, rs1
+  RV_LW,     // lw    rd, imm(rs1)
+  RV_SW,     // sw    rs2, imm(rs1)
+  RV_ADDI,   // addi  rd, rs1, imm, 下面到 RV_SRAI 都是这种格式
+  RV_XORI,
+  RV_ORI,
+  RV_ANDI,
+  RV_SLTI,
+  RV_SLLI,
+  RV_SRLI,
+  RV_SRAI,
+  RV_ADD,    // add   rd, rs1, rs2, 下面到 RV_SGT 都是这种格式
+  RV_SUB,
+  RV_MUL,
+  RV_DIV,
+  RV_REM,
+  RV_AND,
+  RV_OR,
+  RV_XOR,
+  RV_SLT,
+  RV_SGT,
+  RV_SEQZ,   // seqz  rd, rs1
+  RV_SNEZ,   // snez  rd, rs1
+  RV_BEQZ,   // beqz  rs1, label
+  RV_BNEZ,   // bnez  rs1, label
+  RV_J,      // j     label
+  RV_RET,    // ret
+  RV_LABEL,  // label:
+};
+
+// 助记符, 补齐到同样的宽度
+static const char *const rv_op_name[] = {
+  "li    ", "mv    ", "lw    ", "sw    ",
+  "addi  ", "xori  ", "ori   ", "andi  ", "slti  ", "slli  ", "srli  ", "srai  ",
+  "add   ", "sub   ", "mul   ", "div   ", "rem   ", "and   ", "or    ", "xor   ", "slt   ", "sgt   ",
+  "seqz  ", "snez  ", "beqz  ", "bnez  ", "j     ", "ret", "",
+};
+
+// 一条指令, 不用的字段为 -1; 跳转指令和标号的 imm 是基本块的下标
+struct RVInst {
+  RVOp op;
+  int rd;
+  int rs1;
+  int rs2;
+  int imm;
+};
+
+inline RVInst rv_inst(RVOp op, int rd, int rs1, int rs2, int imm) {
+  return RVInst{op, rd, rs1, rs2, imm};
+}
+
+// val 能不能作为 12 位有符号立即数
+inline bool rv_is_imm12(long long val) {
+  return val >= -2048 && val <= 2047;
+}
+
+// 指令写入的寄存器, 没有时返回 -1
+inline int rv_def(const RVInst &inst) {
+  if(inst.op <= RV_SNEZ && inst.op != RV_SW) {
+    return inst.rd;
+  }
+  return -1;
+}
+
+// 对指令读取的每个寄存器调用 f
+template<typename F>
+void rv_for_each_use(const RVInst &inst, F f) {
+  if(inst.op == RV_LI || inst.op == RV_J || inst.op == RV_LABEL) {
+    return;
+  }
+  if(inst.op == RV_RET) {
+    // 返回值和 callee-saved 寄存器在返回之后仍然有用
+    f(RV_A0);
+    f(RV_SP);
+    f(RV_RA);
+    f(RV_S0);
+    f(RV_S1);
+    for(int r = RV_S2; r <= RV_S11; r ++) {
+      f(r);
+    }
+    return;
+  }
+  f(inst.rs1);
+  if(inst.op == RV_SW || (inst.op >= RV_ADD && inst.op <= RV_SGT)) {
+    f(inst.rs2);
+  }
+}
+
+// 输出基本块 bb 的标号
+// 标号只在汇编文件内部使用, 用 .L 开头, 加上函数名保证不同函数的标号不冲突
+inline void DumpLabel(const std::string &func, int bb, Emitter &out) {
+  out << ".L" << func << '_' << bb;
+}
+
+// 输出函数 func 中的一条指令
+inline void DumpRISCV(const std::string &func, const RVInst &inst, Emitter &out) {
+  if(inst.op == RV_LABEL) {
+    DumpLabel(func, inst.imm, out);
+    out << ":\n";
+    return;
+  }
+  out << "  " << rv_op_name[inst.op];
+  switch(inst.op) {
+    case RV_LI:
+      out << rv_reg_name[inst.rd] << ", " << inst.imm;
+      break;
+    case RV_MV:
+    case RV_SEQZ:
+    case RV_SNEZ:
+      out << rv_reg_name[inst.rd] << ", " << rv_reg_name[inst.rs1];
+      break;
+    case RV_LW:
+      out << rv_reg_name[inst.rd] << ", " << inst.imm << '(' << rv_reg_name[inst.rs1] << ')';
+      break;
+    case RV_SW:
+      out << rv_reg_name[inst.rs2] << ", " << inst.imm << '(' << rv_reg_name[inst.rs1] << ')';
+      break;
+    case RV_ADDI:
+    case RV_XORI:
+    case RV_ORI:
+    case RV_ANDI:
+    case RV_SLTI:
+    case RV_SLLI:
+    case RV_SRLI:
+    case RV_SRAI:
+      out << rv_reg_name[inst.rd] << ", " << rv_reg_name[inst.rs1] << ", " << inst.imm;
+      break;
+    case RV_BEQZ:
+    case RV_BNEZ:
+      out << rv_reg_name[inst.rs1] << ", ";
+      DumpLabel(func, inst.imm, out);
+      break;
+    case RV_J:
+      DumpLabel(func, inst.imm, out);
+      break;
+    case RV_RET:
+      break;
+    default:
+      out << rv_reg_name[inst.rd] << ", " << rv_reg_name[inst.rs1] << ", " << rv_reg_name[inst.rs2];
+      break;
+  }
+  out << '\n';
+}
@@ -0,0 +1,34 @@
+// 替换全局的 operator new, 统计打开时记录分配次数和字节数
+// 其他形式的 new (数组, nothrow) 在标准库中都是调用这里的 operator new 实现的
+#include <cstdlib>
+#include <new>
+#include "stats.h"
+
+void *operator new(std::size_t size) {
+  if(stats_enabled) {
+    alloc_count ++;
+    alloc_bytes += size;
+  }
+  if(size == 0) {
+    size = 1;
+  }
+  while(true) {
+    void *p = std::malloc(size);
+    if(p != NULL) {
+      return p;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if(handler == NULL) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void operator delete(void *p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+  std::free(p);
+}
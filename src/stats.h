@@ -0,0 +1,214 @@
+// 编译过程的统计: 每个阶段的墙上时间, CPU 时间和内存分配, 以及各种计数器
+// 命令行参数 -stats 打开统计, 结束时向 stderr 输出报告 (-stats=json 输出 JSON)
+// 统计关闭时, 计时器和计数都只多一次对 stats_enabled 的判断
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 统计开关, 由 main 在编译开始之前设置
+inline bool stats_enabled = false;
+
+// 当前线程上 operator new 的调用次数和申请的字节数, 在 stats.cpp 中累加
+// 每个线程同时只编译一个文件, 所以按线程统计就是按编译统计
+inline thread_local size_t alloc_count = 0;
+inline thread_local size_t alloc_bytes = 0;
+
+// 按 printf 的格式追加到 out
+inline void appendf(std::string &out, const char *fmt, ...) {
+  char buf[512];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  out.append(buf, std::min<size_t>(n, sizeof(buf) - 1));
+}
+
+// 一个阶段的统计, 同名的阶段多次进入时累加
+struct PhaseStats {
+  std::string name;
+  // 在阶段树中的深度, 输出时按深度缩进
+  int depth = 0;
+  size_t calls = 0;
+  double wall_ms = 0;
+  // 小于 0 表示这个阶段没有统计 CPU 时间
+  double cpu_ms = 0;
+  size_t allocs = 0;
+  size_t alloc_bytes = 0;
+};
+
+class StatsReport {
+  public:
+    // 当前正在统计的阶段的嵌套深度
+    int depth = 0;
+    // lex 阶段在 phases 中的下标, 还没有读过 token 时为 -1
+    int lex_phase = -1;
+
+    // 名字为 name 的阶段在 phases 中的下标, 第一次进入时新建, 所以阶段按第一次进入的顺序输出
+    size_t phase(const char *name, int depth) {
+      for(size_t i = 0; i < phases.size(); i ++) {
+        if(phases[i].name == name) {
+          return i;
+        }
+      }
+      phases.emplace_back();
+      phases.back().name = name;
+      phases.back().depth = depth;
+      return phases.size() - 1;
+    }
+
+    PhaseStats &operator[](size_t i) {
+      return phases[i];
+    }
+
+    // 把另一个报告 (例如其他线程上的) 的阶段累加进来, 它的阶段都作为当前正在统计的阶段的子阶段
+    // 多个线程同时执行的阶段累加的是各个线程的时间之和, 可能超过父阶段的墙上时间
+    void merge(const StatsReport &other) {
+      for(const auto &p : other.phases) {
+        PhaseStats &q = phases[phase(p.name.c_str(), depth + p.depth)];
+        q.calls += p.calls;
+        q.wall_ms += p.wall_ms;
+        q.cpu_ms = p.cpu_ms < 0 || q.cpu_ms < 0 ? -1 : q.cpu_ms + p.cpu_ms;
+        q.allocs += p.allocs;
+        q.alloc_bytes += p.alloc_bytes;
+      }
+    }
+
+    void counter(const char *name, size_t value) {
+      counters.emplace_back(name, value);
+    }
+
+    void print_text(std::string &out) const {
+      appendf(out, "%-20s %8s %10s %10s %10s %12s\n", "phase", "calls", "wall ms", "cpu ms", "allocs", "bytes");
+      for(const auto &p : phases) {
+        std::string name = std::string(p.depth * 2, ' ') + p.name;
+        char cpu[32] = "-";
+        if(p.cpu_ms >= 0) {
+          snprintf(cpu, sizeof(cpu), "%.2f", p.cpu_ms);
+        }
+        appendf(out, "%-20s %8zu %10.2f %10s %10zu %12zu\n",
+                name.c_str(), p.calls, p.wall_ms, cpu, p.allocs, p.alloc_bytes);
+      }
+      out += '\n';
+      for(const auto &c : counters) {
+        std::string label = c.first + ':';
+        appendf(out, "%-18s%zu\n", label.c_str(), c.second);
+      }
+    }
+
+    // 计数器的名字在 JSON 中把空格换成下划线
+    void print_json(std::string &out) const {
+      out += "{\n  \"phases\": [";
+      for(size_t i = 0; i < phases.size(); i ++) {
+        const auto &p = phases[i];
+        appendf(out, "%s\n    {\"name\": \"%s\", \"depth\": %d, \"calls\": %zu, \"wall_ms\": %.3f, ",
+                i ? "," : "", p.name.c_str(), p.depth, p.calls, p.wall_ms);
+        if(p.cpu_ms >= 0) {
+          appendf(out, "\"cpu_ms\": %.3f, ", p.cpu_ms);
+        } else {
+          out += "\"cpu_ms\": null, ";
+        }
+        appendf(out, "\"allocs\": %zu, \"alloc_bytes\": %zu}", p.allocs, p.alloc_bytes);
+      }
+      out += "\n  ],\n  \"counters\": {";
+      for(size_t i = 0; i < counters.size(); i ++) {
+        std::string key = counters[i].first;
+        for(auto &ch : key) {
+          if(ch == ' ') {
+            ch = '_';
+          }
+        }
+        appendf(out, "%s\n    \"%s\": %zu", i ? "," : "", key.c_str(), counters[i].second);
+      }
+      out += "\n  }\n}";
+    }
+
+  private:
+    std::vector<PhaseStats> phases;
+    std::vector<std::pair<std::string, size_t>> counters;
+};
+
+// 当前线程正在编译的文件的报告, 由 enter_context() 设置
+inline thread_local StatsReport *cur_report = NULL;
+
+inline double wall_now_ms() {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 当前线程的 CPU 时间, 批量编译时其他线程的时间不算在内
+inline double cpu_now_ms() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+// 统计一个作用域的耗时和内存分配, 作用域内再创建的 PhaseTimer 是它的子阶段
+class PhaseTimer {
+  public:
+    explicit PhaseTimer(const char *name) {
+      if(!stats_enabled || cur_report == NULL) {
+        return;
+      }
+      report = cur_report;
+      index = report->phase(name, report->depth ++);
+      start_allocs = alloc_count;
+      start_bytes = alloc_bytes;
+      start_cpu = cpu_now_ms();
+      start_wall = wall_now_ms();
+    }
+
+    PhaseTimer(const PhaseTimer &) = delete;
+    PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+    ~PhaseTimer() {
+      if(report == NULL) {
+        return;
+      }
+      PhaseStats &p = (*report)[index];
+      p.wall_ms += wall_now_ms() - start_wall;
+      p.cpu_ms += cpu_now_ms() - start_cpu;
+      p.allocs += alloc_count - start_allocs;
+      p.alloc_bytes += alloc_bytes - start_bytes;
+      p.calls ++;
+      report->depth --;
+    }
+
+  private:
+    StatsReport *report = NULL;
+    size_t index = 0;
+    size_t start_allocs = 0;
+    size_t start_bytes = 0;
+    double start_cpu = 0;
+    double start_wall = 0;
+};
+
+// 统计一次 lexer 调用, 返回 lex() 的返回值
+// lexer 由 parser 交替调用, 不能用 PhaseTimer 包住; 每个 token 读两次 CPU 时间的开销太大,
+// 所以这里只统计墙上时间和内存分配, calls 就是读到的 token 数
+template<typename F>
+int count_token(F lex) {
+  if(!stats_enabled || cur_report == NULL) {
+    return lex();
+  }
+  if(cur_report->lex_phase == -1) {
+    cur_report->lex_phase = cur_report->phase("lex", cur_report->depth);
+  }
+  size_t allocs = alloc_count;
+  size_t bytes = alloc_bytes;
+  double start = wall_now_ms();
+  int token = lex();
+  PhaseStats &p = (*cur_report)[cur_report->lex_phase];
+  p.wall_ms += wall_now_ms() - start;
+  p.cpu_ms = -1;
+  p.allocs += alloc_count - allocs;
+  p.alloc_bytes += alloc_bytes - bytes;
+  p.calls ++;
+  return token;
+}
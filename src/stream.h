@@ -0,0 +1,204 @@
+// 按函数流式编译
+// parser 每归约出一个函数就交给 FunctionStream: 立即生成它的 IR, 提升为 SSA 形式并做 GVN 和 DCE, 然后释放它的 AST;
+// IR 攒够一批以后一起生成代码并写进输出文件, 再释放这批 IR 和输出缓冲区
+// 这样峰值内存取决于最大的函数和一批的大小, 而不是整个输入文件
+// 打开函数级缓存时, token 序列和上次编译相同的函数直接使用上次的输出, 跳过 IR 和代码生成
+// 输入是二进制 IR 时, 函数从文件中逐个读出, 同样按批生成代码
+// 只有 main.cpp 引用这个文件, 因为 koopa_handler.h 中的函数不是 inline 的
+#pragma once
+
+#include <cstring>
+#include <string_view>
+#include <vector>
+#include "ast.h"
+#include "compile_cache.h"
+#include "context.h"
+#include "emitter.h"
+#include "ir_binary.h"
+#include "koopa_handler.h"
+#include "stats.h"
+
+class FunctionStream {
+  public:
+    // 一批 IR 至少有这么多条指令才生成代码; 比并行生成的阈值大得多, 一批中的函数仍然可以在多个线程上同时生成
+    static const size_t BATCH_INSTS = PARALLEL_MIN_INSTS * 16;
+    // 从缓存中取出的输出攒够这么多字节就写进输出文件
+    static const size_t WRITE_SIZE = 1 << 20;
+
+    // mode 是 -koopa, -riscv 或 -ir, 生成的代码写进 fd; funcs 不是 NULL 时使用函数级缓存
+    FunctionStream(const char *mode, int fd, FunctionCache *funcs = NULL) : fd(fd), funcs(funcs) {
+      if(strcmp(mode, "-riscv") == 0) {
+        target = RISCV;
+      } else if(strcmp(mode, "-ir") == 0) {
+        target = BINARY_IR;
+      }
+    }
+
+    // parser 归约出了一个函数, tokens 是它的 token 序列
+    void add(BaseAST *func_def, std::string_view tokens) {
+      if(funcs != NULL) {
+        CacheKey key = FunctionCache::key(tokens);
+        std::string_view text;
+        if(funcs->find(key, text)) {
+          // 函数没有变化, 直接使用上次的输出; 先为前面的函数生成代码, 保持函数的顺序
+          cur_ctx->ast_arena.reset();
+          codegen();
+          begin_func();
+          out << text;
+          funcs->add(key, text);
+          cur_ctx->output_stats.reused_funcs ++;
+          if(out.size() >= WRITE_SIZE) {
+            write();
+          }
+          return;
+        }
+        pending_keys.push_back(key);
+      }
+      {
+        PhaseTimer timer("irgen");
+        func_def->Dump();
+      }
+      // IR 已经生成, 这个函数的 AST 不再需要了; parser 的栈上此时没有其他 AST 节点
+      cur_ctx->ast_arena.reset();
+      {
+        PhaseTimer timer("mem2reg");
+        cur_ctx->mem2reg.run(cur_ctx->ir_builder.program.funcs.back());
+      }
+      {
+        PhaseTimer timer("gvn");
+        cur_ctx->gvn.run(cur_ctx->ir_builder.program.funcs.back());
+      }
+      {
+        PhaseTimer timer("dce");
+        cur_ctx->dce.run(cur_ctx->ir_builder.program.funcs.back());
+      }
+      add_loaded();
+    }
+
+    // 从二进制 IR 中读入的函数已经放在 program.funcs 的末尾, 它已经做过 mem2reg, GVN 和 DCE
+    void add_loaded() {
+      for(const auto &bb : cur_ctx->ir_builder.program.funcs.back().bbs) {
+        pending_insts += bb.insts.size();
+      }
+      if(pending_insts >= BATCH_INSTS) {
+        codegen();
+        write();
+      }
+    }
+
+    // 输出剩下的函数, 之前的写入都成功时返回 true
+    bool finish() {
+      codegen();
+      if(target == BINARY_IR) {
+        // 最后写函数目录, 再把它的偏移写回文件头
+        if(emitted == 0) {
+          IRWriter::write_header(out);
+        }
+        func_offsets.push_back(written + out.size());
+        IRWriter::write_directory(func_offsets, out);
+        write();
+        uint64_t directory = func_offsets.back();
+        ok = ok && pwrite(fd, &directory, sizeof(directory), IRWriter::DIRECTORY_FIELD) == sizeof(directory);
+      } else {
+        write();
+      }
+      return ok;
+    }
+
+  private:
+    enum Target { KOOPA, RISCV, BINARY_IR } target = KOOPA;
+    int fd;
+    FunctionCache *funcs;
+    Emitter out;
+    // 已经输出 (包括还在 out 中) 的函数个数
+    size_t emitted = 0;
+    // 还没有生成代码的 IR 指令数, 以及这些函数在函数级缓存中的 key
+    size_t pending_insts = 0;
+    std::vector<CacheKey> pending_keys;
+    // 已经写进输出文件的字节数
+    uint64_t written = 0;
+    // 二进制 IR 中每个函数在文件中的偏移
+    std::vector<uint64_t> func_offsets;
+    bool ok = true;
+
+    // 输出一个函数之前的分隔: RISC-V 在第一个函数之前输出 .text, Koopa IR 在函数之间空一行,
+    // 二进制 IR 在第一个函数之前输出文件头, 并且记下每个函数的偏移
+    void begin_func() {
+      if(target == RISCV && emitted == 0) {
+        out << "  .text\n";
+      } else if(target == KOOPA && emitted > 0) {
+        out << '\n';
+      } else if(target == BINARY_IR) {
+        if(emitted == 0) {
+          IRWriter::write_header(out);
+        }
+        func_offsets.push_back(written + out.size());
+      }
+      emitted ++;
+    }
+
+    // 为已经生成的 IR 生成代码, 追加到 out
+    void codegen() {
+      IRProgram &program = cur_ctx->ir_builder.program;
+      if(program.funcs.empty()) {
+        return;
+      }
+      auto &stats = cur_ctx->output_stats;
+      for(const auto &func : program.funcs) {
+        stats.ir_blocks += func.bbs.size();
+        for(const auto &bb : func.bbs) {
+          stats.ir_insts += bb.insts.size();
+        }
+      }
+      stats.ir_funcs += program.funcs.size();
+      // 每个函数的代码在 out 中的范围, 用来把它们分别存进函数级缓存
+      std::vector<size_t> begins, ends;
+      {
+        PhaseTimer timer("codegen");
+        if(target == RISCV) {
+          // RISC-V 的函数之间没有分隔, 各个函数由后端一起生成, 一个函数的开始就是前一个函数的结束
+          for(size_t i = 0; i < program.funcs.size(); i ++) {
+            begin_func();
+          }
+          begins.push_back(out.size());
+          // 后端直接访问内存中的 IR, 不需要中间文件
+          Visit(program, out, &ends);
+          begins.insert(begins.end(), ends.begin(), ends.end() - 1);
+        } else {
+          for(const auto &func : program.funcs) {
+            begin_func();
+            begins.push_back(out.size());
+            if(target == KOOPA) {
+              DumpKoopa(func, out);
+            } else {
+              IRWriter::write_function(func, out);
+            }
+            ends.push_back(out.size());
+          }
+        }
+      }
+      if(funcs != NULL) {
+        for(size_t i = 0; i < ends.size(); i ++) {
+          funcs->add(pending_keys[i], std::string_view(out.data() + begins[i], ends[i] - begins[i]));
+        }
+        pending_keys.clear();
+      }
+      program.funcs.clear();
+      pending_insts = 0;
+    }
+
+    // 把 out 写进输出文件
+    void write() {
+      PhaseTimer timer("write");
+      // 写入失败以后不再继续写
+      ok = ok && out.write_all(fd);
+      written += out.size();
+      cur_ctx->output_stats.bytes += out.size();
+      out.clear();
+    }
+};
+
+// sysy.y 中的 FuncDefList 在归约出一个函数时调用
+void stream_func_def(FunctionStream *stream, BaseAST *func_def, std::string_view tokens) {
+  stream->add(func_def, tokens);
+}
@@ -0,0 +1,85 @@
+// 符号表
+#pragma once
+
+#include <vector>
+
+// 符号表中的一项
+struct Symbol {
+  // 标识符类型，常量(0)/变量(1)/...
+  int type;
+  // 常量的值, 或者变量对应的 alloc 指令的编号
+  int val;
+  // 声明所在作用域的编号, 用来生成 IR 中的变量名
+  int scope;
+};
+
+// 用栈维护作用域的符号表
+// 每个标识符 (驻留后的编号) 对应一条遮蔽链, 链尾就是当前可见的声明, 所以查找只需要一次数组访问
+// 退出作用域时把这一层声明的标识符从各自的链尾弹出, 作用域的空间留给下一次进入时复用
+class SymbolTable {
+  public:
+    // 开始一个新的函数, 作用域重新从 1 编号
+    // IR 中的变量名只需要在函数内不重复, 这样函数的 IR 和它前面有哪些函数无关, 可以单独缓存
+    void enter_function() {
+      scope_count = 0;
+    }
+
+    // 进入代码块, 新的作用域的编号在函数中唯一
+    void enter_scope() {
+      depth ++;
+      if(depth == (int)scopes.size()) {
+        scopes.emplace_back();
+      }
+      scope_id.resize(depth + 1);
+      scope_id[depth] = ++ scope_count;
+    }
+
+    // 退出代码块, 删除这一层声明的所有标识符
+    void exit_scope() {
+      for(int ident : scopes[depth]) {
+        chains[ident].pop_back();
+      }
+      scopes[depth].clear();
+      depth --;
+    }
+
+    // 在当前作用域中声明标识符, 同一作用域中重复声明时覆盖之前的声明
+    void insert(int ident, int type, int val) {
+      if(ident >= (int)chains.size()) {
+        chains.resize(ident + 1);
+      }
+      auto &chain = chains[ident];
+      if(!chain.empty() && chain.back().scope == cur_scope()) {
+        chain.back().type = type;
+        chain.back().val = val;
+        return;
+      }
+      chain.push_back(Symbol{type, val, cur_scope()});
+      scopes[depth].push_back(ident);
+    }
+
+    // 查找当前可见的声明, 未定义时返回 NULL
+    Symbol *lookup(int ident) {
+      if(ident >= (int)chains.size() || chains[ident].empty()) {
+        return NULL;
+      }
+      return &chains[ident].back();
+    }
+
+    // 当前作用域的编号
+    int cur_scope() const {
+      return scope_id[depth];
+    }
+
+  private:
+    // chains[ident] 是标识符 ident 的遮蔽链
+    std::vector<std::vector<Symbol>> chains;
+    // scopes[i] 是第 i 层作用域中声明的标识符
+    std::vector<std::vector<int>> scopes{1};
+    // scope_id[i] 是第 i 层作用域的编号, 第 0 层表示还没有进入任何代码块
+    std::vector<int> scope_id{0};
+    // 当前所在的层数
+    int depth = 0;
+    // 已经创建过的作用域个数
+    int scope_count = 0;
+};
@@ -4,6 +4,27 @@
   #include <memory>
   #include <string>
   #include "ast.h"
+
+  // 可重入的 lexer 的状态, 定义和 Flex 生成的代码中的相同
+  #ifndef YY_TYPEDEF_YY_SCANNER_T
+  #define YY_TYPEDEF_YY_SCANNER_T
+  typedef void *yyscan_t;
+  #endif
+
+  class FastLexer;
+  class FunctionStream;
+
+  // parser 读取 token 的 lexer: fast 不是 NULL 时用手写的 FastLexer, 否则用 flex 生成的 scanner
+  struct Lexer {
+    yyscan_t scanner = NULL;
+    FastLexer *fast = NULL;
+    // 为 true 时把读到的 token (种类和值) 依次记进 tokens, 函数级缓存用它计算函数的结构哈希
+    // 空白和注释不影响 token 序列, 所以只改格式不会让缓存失效
+    bool record = false;
+    std::string tokens;
+    // 最后一个 token 在 tokens 中的开始位置
+    size_t last_token = 0;
+  };
 }
 
 // 把括号中的内容塞到 Bison 生成的源文件里
@@ -15,20 +36,27 @@
 #include <string.h>
 #include <vector>
 #include "ast.h"
-
-// 声明 lexer 函数和错误处理函数
-int yylex();
-void yyerror(std::unique_ptr<BaseAST> &ast, const char *s);
+#include "stats.h"
 
 using namespace std;
 
+// bison 默认的栈深上限是 10000, 嵌套几千层的代码块或者括号就会 memory exhausted
+// 栈从 YYINITDEPTH 开始按需加倍, 上限调大只有输入确实嵌套这么深时才会用到这么多内存
+#define YYMAXDEPTH 10000000
+
 %}
 
+// lexer 和 parser 都是可重入的: 状态都放在 scanner 和 yyparse 的局部变量里, 没有全局变量,
+// 批量模式下多个线程可以同时解析不同的文件
+// lexer 的状态由调用 parser 的函数创建, 再由 parser 传给 lexer
+%define api.pure full
+%lex-param { Lexer *lexer }
+%parse-param { Lexer *lexer }
+
 // 定义 parser 函数和错误处理函数的附加参数
-// 我们需要返回一个字符串作为 AST, 所以我们把附加参数定义成字符串的智能指针
-// 解析完成后, 我们要手动修改这个参数, 把它设置成解析得到的字符串
-// 后续定义 AST 后，不再生成和源码相同的字符串了，而是要生成一个 AST, 所以这里需要修改, 其他相关声明也应该被修改
-%parse-param { std::unique_ptr<BaseAST> &ast }
+// parser 不再返回整个文件的 AST: 每归约出一个函数就交给 stream 编译并输出, 然后释放它的 AST
+// AST 节点都分配在编译上下文的 ast_arena 中, 由 arena 负责释放, 所以这里用裸指针
+%parse-param { FunctionStream *stream }
 
 // yylval 的定义, 我们把它定义成了一个联合体 (union)
 // 因为 token 的值有的是字符串指针, 有的是整数
@@ -36,126 +64,186 @@ using namespace std;
 // 至于为什么要用字符串指针而不直接用 string 或者 unique_ptr<string>?
 // 请自行 STFW 在 union 里写一个带析构函数的类会出现什么情况
 %union {
-  std::string *str_val;
   int int_val;
+  int sym_val;
+  const char *op_val;
   BaseAST *ast_val;
 }
 
+// 这部分代码在 YYSTYPE 的定义之后
+%code {
+
+#include "fast_lexer.h"
+
+// 声明 flex 生成的 lexer 函数和错误处理函数
+int yylex(YYSTYPE *lval, yyscan_t scanner);
+void yyerror(Lexer *lexer, FunctionStream *stream, const char *s);
+// 编译并输出一个函数, tokens 是它的 token 序列, 定义在 stream.h 中
+void stream_func_def(FunctionStream *stream, BaseAST *func_def, std::string_view tokens);
+
+// 把一个 token 记进 lexer->tokens; 标识符记录字符串而不是编号, 编号和它在文件中第一次出现的位置有关
+static void record_token(Lexer *lexer, int kind, const YYSTYPE &lval) {
+  std::string &tokens = lexer->tokens;
+  lexer->last_token = tokens.size();
+  tokens.append(reinterpret_cast<const char *>(&kind), sizeof(kind));
+  if(kind == IDENT) {
+    const std::string &name = cur_ctx->interner.name(lval.sym_val);
+    int len = name.size();
+    tokens.append(reinterpret_cast<const char *>(&len), sizeof(len));
+    tokens += name;
+  } else if(kind == INT_CONST) {
+    tokens.append(reinterpret_cast<const char *>(&lval.int_val), sizeof(lval.int_val));
+  }
+}
+
+// parser 通过这个函数调用 lexer, 打开统计时记录 token 数和 lexer 的耗时
+static int counted_yylex(YYSTYPE *lval, Lexer *lexer) {
+  int kind = count_token([&] {
+    return lexer->fast != NULL ? lexer->fast->next(lval) : yylex(lval, lexer->scanner);
+  });
+  if(lexer->record) {
+    record_token(lexer, kind, *lval);
+  }
+  return kind;
+}
+
+// 归约出一个函数, 把它和它的 token 序列交给 stream
+// has_lookahead 表示 parser 已经读了下一个 token, 它属于下一个函数, 留在 tokens 中
+static void reduce_func_def(Lexer *lexer, FunctionStream *stream, BaseAST *func_def, bool has_lookahead) {
+  size_t end = has_lookahead ? lexer->last_token : lexer->tokens.size();
+  stream_func_def(stream, func_def, std::string_view(lexer->tokens.data(), end));
+  lexer->tokens.erase(0, end);
+  lexer->last_token = 0;
+}
+#define yylex counted_yylex
+
+}
+
 // lexer 返回的所有 token 种类的声明
-// 注意 IDENT 和 INT_CONST 会返回 token 的值, 分别对应 str_val 和 int_val
+// 注意 IDENT 和 INT_CONST 会返回 token 的值, 分别对应 sym_val 和 int_val
+// IDENT 的值是标识符在驻留表中的编号
 %token INT RETURN CONST EQUAL_OR_LESSER EQUAL_OR_GREATER EQUAL NOT_EQUAL AND OR
-%token <str_val> IDENT
+%token <sym_val> IDENT
 %token <int_val> INT_CONST
 
 // 非终结符的类型定义
 %type <ast_val> FuncDef FuncType Block Stmt Exp UnaryExp PrimaryExp Number MulExp AddExp RelExp EqExp LAndExp LOrExp ConstExp
-%type <ast_val> Decl ConstDecl VarDecl BType ConstDef VarDef InitVal ConstInitVal BlockItem LVal
-%type <str_val> UnaryOp
+%type <ast_val> Decl ConstDecl VarDecl BType ConstDef ConstDefList VarDef VarDefList InitVal ConstInitVal
+%type <ast_val> BlockItem BlockItemList LVal
+%type <op_val> UnaryOp
 
 %%
 
-// 开始符, CompUnit ::= FuncDef, 大括号后声明了解析完成后 parser 要做的事情
-// 之前我们定义了 FuncDef 会返回一个 str_val, 也就是字符串指针
-// 而 parser 一旦解析完 CompUnit, 就说明所有的 token 都被解析了, 即解析结束了
-// 此时我们应该把 FuncDef 返回的结果收集起来, 作为 AST 传给调用 parser 的函数
-// $1 指代规则里第一个符号的返回值, 也就是 FuncDef 的返回值
+// 开始符, CompUnit ::= FuncDef {FuncDef}
+// parser 一旦解析完 CompUnit, 就说明所有的 token 都被解析了, 即解析结束了
+// 所有函数都已经在归约时交给了 stream, 这里不需要再做什么
 CompUnit
+  : FuncDefList
+  ;
+
+// 用左递归依次归约每个函数, 函数再多也不会占用 parser 的栈
+// 每个函数归约出来就交给 stream, 它的 AST 随后被释放, 所以 FuncDefList 没有值
+FuncDefList
   : FuncDef {
-    auto comp_unit = make_unique<CompUnitAST>();
-    comp_unit->func_def = unique_ptr<BaseAST>($1);
-    ast = move(comp_unit);
+    reduce_func_def(lexer, stream, $1, yychar != YYEMPTY);
+  } | FuncDefList FuncDef {
+    reduce_func_def(lexer, stream, $2, yychar != YYEMPTY);
   }
   ;
 
 Decl
   : ConstDecl {
-    auto ast = new DeclAST();
-    ast->decl = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<DeclAST>();
+    ast->decl = $1;
     $$ = ast;
   } | VarDecl {
-    auto ast = new DeclAST();
-    ast->decl = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<DeclAST>();
+    ast->decl = $1;
     $$ = ast;
   }
   ;
 
 ConstDecl
-  : CONST BType ConstDef ';' {
-    auto ast = new ConstDeclAST();
-    ast->btype = unique_ptr<BaseAST>($2);
-    ast->const_def = unique_ptr<BaseAST>($3);
+  : CONST BType ConstDefList ';' {
+    auto ast = static_cast<ConstDeclAST *>($3);
+    ast->btype = $2;
     $$ = ast;
   }
   ;
 
+// 和 FuncDefList 一样用左递归, 依次放进同一个 ConstDeclAST
+ConstDefList
+  : ConstDef {
+    auto ast = cur_ctx->ast_arena.make<ConstDeclAST>();
+    ast->const_defs.push_back($1);
+    $$ = ast;
+  } | ConstDefList ',' ConstDef {
+    static_cast<ConstDeclAST *>($1)->const_defs.push_back($3);
+    $$ = $1;
+  }
+  ;
+
 BType
   : INT {
-    auto ast = new BTypeAST();
-    ast->type = *new string("int");
+    auto ast = cur_ctx->ast_arena.make<BTypeAST>();
+    ast->type = "int";
     $$ = ast;
   }
   ;
 
 ConstDef
   : IDENT '=' ConstInitVal {
-    auto ast = new ConstDefAST();
-    ast->ident = *unique_ptr<string>($1);
-    ast->constInitVal = unique_ptr<BaseAST>($3);
-    $$ = ast;
-  } | IDENT '=' ConstInitVal ',' ConstDef {
-    auto ast = new ConstDefAST();
-    ast->ident = *unique_ptr<string>($1);
-    ast->constInitVal = unique_ptr<BaseAST>($3);
-    ast->const_def = unique_ptr<BaseAST>($5);
+    auto ast = cur_ctx->ast_arena.make<ConstDefAST>();
+    ast->ident = $1;
+    ast->constInitVal = $3;
     $$ = ast;
   }
   ;
 
 ConstInitVal
   : ConstExp {
-    auto ast = new ConstInitValAST();
-    ast->const_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<ConstInitValAST>();
+    ast->const_exp = $1;
     $$ = ast;
   }
   ;
 
 VarDecl
-  : BType VarDef ';' {
-    auto ast = new VarDeclAST();
-    ast->btype = unique_ptr<BaseAST>($1);
-    ast->var_def = unique_ptr<BaseAST>($2);
+  : BType VarDefList ';' {
+    auto ast = static_cast<VarDeclAST *>($2);
+    ast->btype = $1;
     $$ = ast;
   }
   ;
 
+VarDefList
+  : VarDef {
+    auto ast = cur_ctx->ast_arena.make<VarDeclAST>();
+    ast->var_defs.push_back($1);
+    $$ = ast;
+  } | VarDefList ',' VarDef {
+    static_cast<VarDeclAST *>($1)->var_defs.push_back($3);
+    $$ = $1;
+  }
+  ;
+
 VarDef
   : IDENT {
-    auto ast = new VarDefAST();
-    ast->ident = *unique_ptr<string>($1);
-    $$ = ast;
-  } | IDENT ',' VarDef {
-    auto ast = new VarDefAST();
-    ast->ident = *unique_ptr<string>($1);
-    ast->var_def = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<VarDefAST>();
+    ast->ident = $1;
     $$ = ast;
   } | IDENT '=' InitVal {
-    auto ast = new VarDefAST();
-    ast->ident = *unique_ptr<string>($1);
-    ast->init_val = unique_ptr<BaseAST>($3);
-    $$ = ast;
-  } | IDENT '=' InitVal ',' VarDef {
-    auto ast = new VarDefAST();
-    ast->ident = *unique_ptr<string>($1);
-    ast->init_val = unique_ptr<BaseAST>($3);
-    ast->var_def = unique_ptr<BaseAST>($5);
+    auto ast = cur_ctx->ast_arena.make<VarDefAST>();
+    ast->ident = $1;
+    ast->init_val = $3;
     $$ = ast;
   }
   ;
 
 InitVal
   : Exp {
-    auto ast = new InitValAST();
-    ast->exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<InitValAST>();
+    ast->exp = $1;
     $$ = ast;
   }
   ;
@@ -172,10 +260,10 @@ InitVal
 // 这种写法会省下很多内存管理的负担
 FuncDef
   : FuncType IDENT '(' ')' Block {
-    auto ast = new FuncDefAST();
-    ast->func_type = unique_ptr<BaseAST>($1);
-    ast->ident = *unique_ptr<string>($2);
-    ast->block = unique_ptr<BaseAST>($5);
+    auto ast = cur_ctx->ast_arena.make<FuncDefAST>();
+    ast->func_type = $1;
+    ast->ident = $2;
+    ast->block = $5;
     $$ = ast;
   }
   ;
@@ -183,111 +271,105 @@ FuncDef
 // 同上, 不再解释
 FuncType
   : INT {
-    auto ast = new FuncType();
-    auto i = new string("int");
-    ast->_int = *unique_ptr<string>(i);
+    auto ast = cur_ctx->ast_arena.make<FuncType>();
+    ast->_int = "int";
     $$ = ast;
   }
   ;
 
 Block
-  : '{' BlockItem '}' {
-    auto ast = new BlockAST();
-    ast->block_item = unique_ptr<BaseAST>($2);
-    $$ = ast;
+  : '{' BlockItemList '}' {
+    $$ = $2;
   }
   ;
 
-BlockItem
+// 代码块中的语句同样用左递归依次放进 BlockAST, 语句再多 parser 的栈也不会变深
+BlockItemList
   : {
-    auto ast = new BlockItemAST();
-    ast->decl = NULL;
-    ast->stmt = NULL;
-    ast->block_item = NULL;
-    $$ = ast;
-  } | Decl BlockItem {
-    auto ast = new BlockItemAST();
-    ast->decl = unique_ptr<BaseAST>($1);
-    ast->stmt = NULL;
-    ast->block_item = unique_ptr<BaseAST>($2);
-    $$ = ast;
-  } | Stmt BlockItem {
-    auto ast = new BlockItemAST();
-    ast->decl = NULL;
-    ast->stmt = unique_ptr<BaseAST>($1);
-    ast->block_item = unique_ptr<BaseAST>($2);
-    $$ = ast;
+    $$ = cur_ctx->ast_arena.make<BlockAST>();
+  } | BlockItemList BlockItem {
+    static_cast<BlockAST *>($1)->items.push_back($2);
+    $$ = $1;
+  }
+  ;
+
+// 代码块中的一项直接就是 Decl 或者 Stmt
+BlockItem
+  : Decl {
+    $$ = $1;
+  } | Stmt {
+    $$ = $1;
   }
   ;
 
 Stmt
   : LVal '=' Exp ';' {
-    auto ast = new StmtAST();
+    auto ast = cur_ctx->ast_arena.make<StmtAST>();
     ast->type = 0;
-    ast->lval = unique_ptr<BaseAST>($1);
-    ast->exp = unique_ptr<BaseAST>($3);
+    ast->lval = $1;
+    ast->exp = $3;
     $$ = ast;
   } | ';' {
-    auto ast = new StmtAST();
+    auto ast = cur_ctx->ast_arena.make<StmtAST>();
     ast->type = 1;
     $$ = ast;
   } | Exp ';' {
-    auto ast = new StmtAST();
+    auto ast = cur_ctx->ast_arena.make<StmtAST>();
     ast->type = 2;
-    ast->exp = unique_ptr<BaseAST>($1);
+    ast->exp = $1;
     $$ = ast;
   } | Block {
-    auto ast = new StmtAST();
+    auto ast = cur_ctx->ast_arena.make<StmtAST>();
     ast->type = 3;
-    ast->block = unique_ptr<BaseAST>($1);
+    ast->block = $1;
     $$ = ast;
   } | RETURN ';' {
-    auto ast = new StmtAST();
+    auto ast = cur_ctx->ast_arena.make<StmtAST>();
     ast->type = 4;
     $$ = ast;
   } | RETURN Exp ';' {
-    auto ast = new StmtAST();
+    auto ast = cur_ctx->ast_arena.make<StmtAST>();
     ast->type = 5;
-    ast->exp = unique_ptr<BaseAST>($2);
+    ast->exp = $2;
     $$ = ast;
   }
   ;
 
 Exp
   : LOrExp {
-    auto ast = new ExpAST();
-    ast->exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<ExpAST>();
+    ast->exp = $1;
     $$ = ast;
   }
   ;
 
 LVal
   : IDENT {
-    auto ast = new LValAST();
-    ast->ident = *unique_ptr<string>($1);
+    auto ast = cur_ctx->ast_arena.make<LValAST>();
+    ast->ident = $1;
     $$ = ast;
   }
   ;
 
 PrimaryExp
   : '(' Exp ')' {
-    auto ast = new PrimaryExpAST();
-    ast->p_exp = unique_ptr<BaseAST>($2);
+    auto ast = cur_ctx->ast_arena.make<PrimaryExpAST>();
+    ast->p_exp = $2;
     $$ = ast;
   } | LVal {
-    auto ast = new PrimaryExpAST();
-    ast->p_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<PrimaryExpAST>();
+    ast->p_exp = $1;
     $$ = ast;
   } | Number {
-    auto ast = new PrimaryExpAST();
-    ast->p_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<PrimaryExpAST>();
+    ast->p_exp = $1;
     $$ = ast;
   }
   ;
 
 Number
   : INT_CONST {
-    auto ast = new NumberAST();
+    auto ast = cur_ctx->ast_arena.make<NumberAST>();
     ast->val = $1;
     $$ = ast;
   }
@@ -295,176 +377,189 @@ Number
 
 UnaryExp
   : PrimaryExp {
-    auto ast = new UnaryExpAST();
-    ast->op_ident = *new string("");
-    ast->u_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<UnaryExpAST>();
+    ast->op_ident = "";
+    ast->u_exp = $1;
     $$ = ast;
   } | UnaryOp UnaryExp {
-    auto ast = new UnaryExpAST();
-    ast->op_ident = *unique_ptr<string>($1);
-    ast->u_exp = unique_ptr<BaseAST>($2);
+    auto ast = cur_ctx->ast_arena.make<UnaryExpAST>();
+    ast->op_ident = $1;
+    ast->u_exp = $2;
     $$ = ast;
   }
   ;
 
 UnaryOp
   : '+' {
-    $$ = new string("+");
+    $$ = "+";
   } | '-' {
-    $$ = new string("-");
+    $$ = "-";
   } | '!' {
-    $$ = new string("!");
+    $$ = "!";
   }
   ;
 
 MulExp
   : UnaryExp {
-    auto ast = new MulExpAST();
-    ast->op_ident = *new string("");
-    ast->unary_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<MulExpAST>();
+    ast->op_ident = "";
+    ast->unary_exp = $1;
     $$ = ast;
   } | MulExp '*' UnaryExp {
-    auto ast = new MulExpAST();
-    ast->op_ident = *new string("*");
-    ast->mul_exp = unique_ptr<BaseAST>($1);
-    ast->unary_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<MulExpAST>();
+    ast->op_ident = "*";
+    ast->mul_exp = $1;
+    ast->unary_exp = $3;
     $$ = ast;
   } | MulExp '/' UnaryExp {
-    auto ast = new MulExpAST();
-    ast->op_ident = *new string("/");
-    ast->mul_exp = unique_ptr<BaseAST>($1);
-    ast->unary_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<MulExpAST>();
+    ast->op_ident = "/";
+    ast->mul_exp = $1;
+    ast->unary_exp = $3;
     $$ = ast;
   } | MulExp '%' UnaryExp {
-    auto ast = new MulExpAST();
-    ast->op_ident = *new string("%");
-    ast->mul_exp = unique_ptr<BaseAST>($1);
-    ast->unary_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<MulExpAST>();
+    ast->op_ident = "%";
+    ast->mul_exp = $1;
+    ast->unary_exp = $3;
     $$ = ast;
   }
   ;
 
 AddExp
   : MulExp {
-    auto ast = new AddExpAST();
-    ast->op_ident = *new string("");
-    ast->mul_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<AddExpAST>();
+    ast->op_ident = "";
+    ast->mul_exp = $1;
     $$ = ast;
   } | AddExp '+' MulExp {
-    auto ast = new AddExpAST();
-    ast->op_ident = *new string("+");
-    ast->add_exp = unique_ptr<BaseAST>($1);
-    ast->mul_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<AddExpAST>();
+    ast->op_ident = "+";
+    ast->add_exp = $1;
+    ast->mul_exp = $3;
     $$ = ast;
   } | AddExp '-' MulExp {
-    auto ast = new AddExpAST();
-    ast->op_ident = *new string("-");
-    ast->add_exp = unique_ptr<BaseAST>($1);
-    ast->mul_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<AddExpAST>();
+    ast->op_ident = "-";
+    ast->add_exp = $1;
+    ast->mul_exp = $3;
     $$ = ast;
   }
   ;
 
 RelExp
   : AddExp {
-    auto ast = new RelExpAST();
-    ast->op_ident = *new string("");
-    ast->add_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<RelExpAST>();
+    ast->op_ident = "";
+    ast->add_exp = $1;
     $$ = ast;
   } | RelExp '<' AddExp {
-    auto ast = new RelExpAST();
-    ast->op_ident = *new string("<");
-    ast->rel_exp = unique_ptr<BaseAST>($1);
-    ast->add_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<RelExpAST>();
+    ast->op_ident = "<";
+    ast->rel_exp = $1;
+    ast->add_exp = $3;
     $$ = ast;
   } | RelExp '>' AddExp {
-    auto ast = new RelExpAST();
-    ast->op_ident = *new string(">");
-    ast->rel_exp = unique_ptr<BaseAST>($1);
-    ast->add_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<RelExpAST>();
+    ast->op_ident = ">";
+    ast->rel_exp = $1;
+    ast->add_exp = $3;
     $$ = ast;
   } | RelExp EQUAL_OR_LESSER AddExp {
-    auto ast = new RelExpAST();
-    ast->op_ident = *new string("<=");
-    ast->rel_exp = unique_ptr<BaseAST>($1);
-    ast->add_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<RelExpAST>();
+    ast->op_ident = "<=";
+    ast->rel_exp = $1;
+    ast->add_exp = $3;
     $$ = ast;
   } | RelExp EQUAL_OR_GREATER AddExp {
-    auto ast = new RelExpAST();
-    ast->op_ident = *new string(">=");
-    ast->rel_exp = unique_ptr<BaseAST>($1);
-    ast->add_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<RelExpAST>();
+    ast->op_ident = ">=";
+    ast->rel_exp = $1;
+    ast->add_exp = $3;
     $$ = ast;
   }
   ;
 
 EqExp
   : RelExp {
-    auto ast = new EqExpAST();
-    ast->op_ident = *new string("");
-    ast->rel_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<EqExpAST>();
+    ast->op_ident = "";
+    ast->rel_exp = $1;
     $$ = ast;
   } | EqExp EQUAL RelExp {
-    auto ast = new EqExpAST();
-    ast->op_ident = *new string("==");
-    ast->eq_exp = unique_ptr<BaseAST>($1);
-    ast->rel_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<EqExpAST>();
+    ast->op_ident = "==";
+    ast->eq_exp = $1;
+    ast->rel_exp = $3;
     $$ = ast;
   } | EqExp NOT_EQUAL RelExp {
-    auto ast = new EqExpAST();
-    ast->op_ident = *new string("!=");
-    ast->eq_exp = unique_ptr<BaseAST>($1);
-    ast->rel_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<EqExpAST>();
+    ast->op_ident = "!=";
+    ast->eq_exp = $1;
+    ast->rel_exp = $3;
     $$ = ast;
   }
   ;
 
 LAndExp
   : EqExp {
-    auto ast = new LAndExpAST();
-    ast->op_ident = *new string("");
-    ast->eq_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<LAndExpAST>();
+    ast->op_ident = "";
+    ast->eq_exp = $1;
     $$ = ast;
   } | LAndExp AND EqExp {
-    auto ast = new LAndExpAST();
-    ast->op_ident = *new string("&&");
-    ast->land_exp = unique_ptr<BaseAST>($1);
-    ast->eq_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<LAndExpAST>();
+    ast->op_ident = "&&";
+    ast->land_exp = $1;
+    ast->eq_exp = $3;
     $$ = ast;
   }
   ;
 
 LOrExp
   : LAndExp {
-    auto ast = new LOrExpAST();
-    ast->op_ident = *new string("");
-    ast->land_exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<LOrExpAST>();
+    ast->op_ident = "";
+    ast->land_exp = $1;
     $$ = ast;
   } | LOrExp OR LAndExp {
-    auto ast = new LOrExpAST();
-    ast->op_ident = *new string("||");
-    ast->lor_exp = unique_ptr<BaseAST>($1);
-    ast->land_exp = unique_ptr<BaseAST>($3);
+    auto ast = cur_ctx->ast_arena.make<LOrExpAST>();
+    ast->op_ident = "||";
+    ast->lor_exp = $1;
+    ast->land_exp = $3;
     $$ = ast;
   }
   ;
 
 ConstExp
   : Exp {
-    auto ast = new ConstExpAST();
-    ast->exp = unique_ptr<BaseAST>($1);
+    auto ast = cur_ctx->ast_arena.make<ConstExpAST>();
+    ast->exp = $1;
     $$ = ast;
   }
   ;
 
 %%
 
-// 定义错误处理函数, 其中第二个参数是错误信息
+// 定义错误处理函数, 其中最后一个参数是错误信息
 // parser 如果发生错误 (例如输入的程序出现了语法错误), 就会调用这个函数
-void yyerror(std::unique_ptr<BaseAST> &ast, const char *s) {
-  extern int yylineno;    // defined and maintained in lex
-  extern char *yytext;    // defined and maintained in lex
-  int len = strlen(yytext);
+void yyerror(Lexer *lexer, FunctionStream *stream, const char *s) {
+  // 可重入的 lexer 没有全局的 yytext 和 yylineno, 要从 lexer 读取
+  extern char *yyget_text(yyscan_t scanner);
+  extern int yyget_lineno(yyscan_t scanner);
+  const char *yytext;
+  int len, yylineno;
+  if(lexer->fast != NULL) {
+    // FastLexer 的 token 文本直接指向输入, 没有结尾的 '\0'
+    std::string_view text = lexer->fast->text(lexer->fast->token());
+    yytext = text.data();
+    len = text.size();
+    yylineno = lexer->fast->lineno();
+  } else {
+    yytext = yyget_text(lexer->scanner);
+    len = strlen(yytext);
+    yylineno = yyget_lineno(lexer->scanner);
+  }
   int i;
   char buf[512] = {0};
   for (i = 0; i < len; i ++){
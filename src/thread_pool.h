@@ -0,0 +1,146 @@
+// 线程池, 以及把一组互相独立的任务分给多个线程执行的 parallel_for
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+  public:
+    explicit ThreadPool(size_t thread_num) {
+      if(thread_num == 0) {
+        thread_num = 1;
+      }
+      for(size_t i = 0; i < thread_num; i ++) {
+        workers.emplace_back([this] { work(); });
+      }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // 等待已经提交的任务全部完成后结束所有线程
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+      has_task.notify_all();
+      for(auto &worker : workers) {
+        worker.join();
+      }
+    }
+
+    // 提交一个任务, 任务按提交的顺序开始执行
+    void submit(std::function<void()> task) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+        unfinished ++;
+      }
+      has_task.notify_one();
+    }
+
+    // 等待所有已经提交的任务完成
+    void wait() {
+      std::unique_lock<std::mutex> lock(mutex);
+      all_done.wait(lock, [this] { return unfinished == 0; });
+    }
+
+    size_t size() const {
+      return workers.size();
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable has_task;
+    std::condition_variable all_done;
+    // 已经提交但还没有执行完的任务数
+    size_t unfinished = 0;
+    bool stopping = false;
+
+    void work() {
+      while(true) {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          has_task.wait(lock, [this] { return stopping || !tasks.empty(); });
+          if(tasks.empty()) {
+            return;
+          }
+          task = std::move(tasks.front());
+          tasks.pop_front();
+        }
+        task();
+        std::lock_guard<std::mutex> lock(mutex);
+        if(-- unfinished == 0) {
+          all_done.notify_all();
+        }
+      }
+    }
+};
+
+// 用 thread_num 个线程 (包括调用者所在的线程) 执行 task(0), task(1), ..., task(n - 1), 全部完成后返回
+// 下标先按连续的区间平均分给每个线程的队列, 线程从自己队列的头部取任务,
+// 自己的队列空了之后从其他线程队列的尾部偷任务, 所以任务的耗时相差很多时各个线程也能一直有事做
+// 执行过程中不会再加入新任务, 所以一个线程在所有队列里都找不到任务时就可以结束了
+template<typename F>
+void parallel_for(size_t n, size_t thread_num, F task) {
+  thread_num = std::min(thread_num, n);
+  if(thread_num <= 1) {
+    for(size_t i = 0; i < n; i ++) {
+      task(i);
+    }
+    return;
+  }
+  struct Queue {
+    std::mutex mutex;
+    std::deque<size_t> tasks;
+  };
+  std::vector<Queue> queues(thread_num);
+  for(size_t i = 0; i < n; i ++) {
+    queues[i * thread_num / n].tasks.push_back(i);
+  }
+  // 取出线程 self 的下一个任务, 没有任务时返回 false
+  auto next = [&](size_t self, size_t &i) {
+    {
+      std::lock_guard<std::mutex> lock(queues[self].mutex);
+      if(!queues[self].tasks.empty()) {
+        i = queues[self].tasks.front();
+        queues[self].tasks.pop_front();
+        return true;
+      }
+    }
+    for(size_t k = 1; k < thread_num; k ++) {
+      Queue &victim = queues[(self + k) % thread_num];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if(!victim.tasks.empty()) {
+        i = victim.tasks.back();
+        victim.tasks.pop_back();
+        return true;
+      }
+    }
+    return false;
+  };
+  auto work = [&](size_t self) {
+    size_t i;
+    while(next(self, i)) {
+      task(i);
+    }
+  };
+  std::vector<std::thread> workers;
+  for(size_t t = 1; t < thread_num; t ++) {
+    workers.emplace_back(work, t);
+  }
+  work(0);
+  for(auto &worker : workers) {
+    worker.join();
+  }
+}
@@ -0,0 +1,38 @@
+// 负数的除法和取模向 0 取整, 乘除 2 的幂次等常量时的化简, 溢出按 32 位回绕
+int main() {
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int x = one * -37;
+  int y = one * 37;
+  int max = one * 2147483647;
+  int min = -max - one;
+  int r = 0;
+  r = r * 31 + x / 4;
+  r = r * 31 + x % 4;
+  r = r * 31 + y / 4;
+  r = r * 31 + y % 4;
+  r = r * 31 + x / -4;
+  r = r * 31 + x % -4;
+  r = r * 31 + x / 1;
+  r = r * 31 + x / -1;
+  r = r * 31 + x % 1;
+  r = r * 31 + x / 7;
+  r = r * 31 + x % 7;
+  r = r * 31 + y / 3;
+  r = r * 31 + x * 8;
+  r = r * 31 + x * -16;
+  r = r * 31 + y * 9;
+  r = r * 31 + y * 7;
+  r = r * 31 + y * 0;
+  r = r * 31 + x * -1;
+  r = r * 31 + min / 2;
+  r = r * 31 + min % 2;
+  r = r * 31 + min / 65536;
+  r = r * 31 + (max + one);
+  r = r * 31 + min * -1;
+  r = r * 31 + max * max;
+  r = r * 31 + (min - one) / 3;
+  r = r * 31 + min / max;
+  r = r * 31 + min % max;
+  return r;
+}
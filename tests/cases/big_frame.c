@@ -0,0 +1,1209 @@
+// 600 个同时活跃的值, 栈帧超过 2047 字节: 调整 sp 要先用 li 装入偏移量,
+// 访问偏移量超过 2047 的栈上位置也要先算出地址
+int main() {
+  // 运行时才知道 one 的值: && 的右边有除法, 不能提前计算, 两条路径在基本块参数处汇合
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int v0 = one * 3 + 0;
+  int v1 = one * 10 + 1;
+  int v2 = one * 17 + 2;
+  int v3 = one * 24 + 3;
+  int v4 = one * 31 + 4;
+  int v5 = one * 38 + 0;
+  int v6 = one * 45 + 1;
+  int v7 = one * 52 + 2;
+  int v8 = one * 59 + 3;
+  int v9 = one * 66 + 4;
+  int v10 = one * 73 + 0;
+  int v11 = one * 80 + 1;
+  int v12 = one * 87 + 2;
+  int v13 = one * 94 + 3;
+  int v14 = one * 101 + 4;
+  int v15 = one * 108 + 0;
+  int v16 = one * 115 + 1;
+  int v17 = one * 122 + 2;
+  int v18 = one * 129 + 3;
+  int v19 = one * 136 + 4;
+  int v20 = one * 143 + 0;
+  int v21 = one * 150 + 1;
+  int v22 = one * 157 + 2;
+  int v23 = one * 164 + 3;
+  int v24 = one * 171 + 4;
+  int v25 = one * 178 + 0;
+  int v26 = one * 185 + 1;
+  int v27 = one * 192 + 2;
+  int v28 = one * 199 + 3;
+  int v29 = one * 206 + 4;
+  int v30 = one * 213 + 0;
+  int v31 = one * 220 + 1;
+  int v32 = one * 227 + 2;
+  int v33 = one * 234 + 3;
+  int v34 = one * 241 + 4;
+  int v35 = one * 248 + 0;
+  int v36 = one * 255 + 1;
+  int v37 = one * 262 + 2;
+  int v38 = one * 269 + 3;
+  int v39 = one * 276 + 4;
+  int v40 = one * 283 + 0;
+  int v41 = one * 290 + 1;
+  int v42 = one * 297 + 2;
+  int v43 = one * 304 + 3;
+  int v44 = one * 311 + 4;
+  int v45 = one * 318 + 0;
+  int v46 = one * 325 + 1;
+  int v47 = one * 332 + 2;
+  int v48 = one * 339 + 3;
+  int v49 = one * 346 + 4;
+  int v50 = one * 353 + 0;
+  int v51 = one * 360 + 1;
+  int v52 = one * 367 + 2;
+  int v53 = one * 374 + 3;
+  int v54 = one * 381 + 4;
+  int v55 = one * 388 + 0;
+  int v56 = one * 395 + 1;
+  int v57 = one * 402 + 2;
+  int v58 = one * 409 + 3;
+  int v59 = one * 416 + 4;
+  int v60 = one * 423 + 0;
+  int v61 = one * 430 + 1;
+  int v62 = one * 437 + 2;
+  int v63 = one * 444 + 3;
+  int v64 = one * 451 + 4;
+  int v65 = one * 458 + 0;
+  int v66 = one * 465 + 1;
+  int v67 = one * 472 + 2;
+  int v68 = one * 479 + 3;
+  int v69 = one * 486 + 4;
+  int v70 = one * 493 + 0;
+  int v71 = one * 500 + 1;
+  int v72 = one * 507 + 2;
+  int v73 = one * 514 + 3;
+  int v74 = one * 521 + 4;
+  int v75 = one * 528 + 0;
+  int v76 = one * 535 + 1;
+  int v77 = one * 542 + 2;
+  int v78 = one * 549 + 3;
+  int v79 = one * 556 + 4;
+  int v80 = one * 563 + 0;
+  int v81 = one * 570 + 1;
+  int v82 = one * 577 + 2;
+  int v83 = one * 584 + 3;
+  int v84 = one * 591 + 4;
+  int v85 = one * 598 + 0;
+  int v86 = one * 605 + 1;
+  int v87 = one * 612 + 2;
+  int v88 = one * 619 + 3;
+  int v89 = one * 626 + 4;
+  int v90 = one * 633 + 0;
+  int v91 = one * 640 + 1;
+  int v92 = one * 647 + 2;
+  int v93 = one * 654 + 3;
+  int v94 = one * 661 + 4;
+  int v95 = one * 668 + 0;
+  int v96 = one * 675 + 1;
+  int v97 = one * 682 + 2;
+  int v98 = one * 689 + 3;
+  int v99 = one * 696 + 4;
+  int v100 = one * 703 + 0;
+  int v101 = one * 710 + 1;
+  int v102 = one * 717 + 2;
+  int v103 = one * 724 + 3;
+  int v104 = one * 731 + 4;
+  int v105 = one * 738 + 0;
+  int v106 = one * 745 + 1;
+  int v107 = one * 752 + 2;
+  int v108 = one * 759 + 3;
+  int v109 = one * 766 + 4;
+  int v110 = one * 773 + 0;
+  int v111 = one * 780 + 1;
+  int v112 = one * 787 + 2;
+  int v113 = one * 794 + 3;
+  int v114 = one * 801 + 4;
+  int v115 = one * 808 + 0;
+  int v116 = one * 815 + 1;
+  int v117 = one * 822 + 2;
+  int v118 = one * 829 + 3;
+  int v119 = one * 836 + 4;
+  int v120 = one * 843 + 0;
+  int v121 = one * 850 + 1;
+  int v122 = one * 857 + 2;
+  int v123 = one * 864 + 3;
+  int v124 = one * 871 + 4;
+  int v125 = one * 878 + 0;
+  int v126 = one * 885 + 1;
+  int v127 = one * 892 + 2;
+  int v128 = one * 899 + 3;
+  int v129 = one * 906 + 4;
+  int v130 = one * 913 + 0;
+  int v131 = one * 920 + 1;
+  int v132 = one * 927 + 2;
+  int v133 = one * 934 + 3;
+  int v134 = one * 941 + 4;
+  int v135 = one * 948 + 0;
+  int v136 = one * 955 + 1;
+  int v137 = one * 962 + 2;
+  int v138 = one * 969 + 3;
+  int v139 = one * 976 + 4;
+  int v140 = one * 983 + 0;
+  int v141 = one * 990 + 1;
+  int v142 = one * 997 + 2;
+  int v143 = one * 1004 + 3;
+  int v144 = one * 1011 + 4;
+  int v145 = one * 1018 + 0;
+  int v146 = one * 1025 + 1;
+  int v147 = one * 1032 + 2;
+  int v148 = one * 1039 + 3;
+  int v149 = one * 1046 + 4;
+  int v150 = one * 1053 + 0;
+  int v151 = one * 1060 + 1;
+  int v152 = one * 1067 + 2;
+  int v153 = one * 1074 + 3;
+  int v154 = one * 1081 + 4;
+  int v155 = one * 1088 + 0;
+  int v156 = one * 1095 + 1;
+  int v157 = one * 1102 + 2;
+  int v158 = one * 1109 + 3;
+  int v159 = one * 1116 + 4;
+  int v160 = one * 1123 + 0;
+  int v161 = one * 1130 + 1;
+  int v162 = one * 1137 + 2;
+  int v163 = one * 1144 + 3;
+  int v164 = one * 1151 + 4;
+  int v165 = one * 1158 + 0;
+  int v166 = one * 1165 + 1;
+  int v167 = one * 1172 + 2;
+  int v168 = one * 1179 + 3;
+  int v169 = one * 1186 + 4;
+  int v170 = one * 1193 + 0;
+  int v171 = one * 1200 + 1;
+  int v172 = one * 1207 + 2;
+  int v173 = one * 1214 + 3;
+  int v174 = one * 1221 + 4;
+  int v175 = one * 1228 + 0;
+  int v176 = one * 1235 + 1;
+  int v177 = one * 1242 + 2;
+  int v178 = one * 1249 + 3;
+  int v179 = one * 1256 + 4;
+  int v180 = one * 1263 + 0;
+  int v181 = one * 1270 + 1;
+  int v182 = one * 1277 + 2;
+  int v183 = one * 1284 + 3;
+  int v184 = one * 1291 + 4;
+  int v185 = one * 1298 + 0;
+  int v186 = one * 1305 + 1;
+  int v187 = one * 1312 + 2;
+  int v188 = one * 1319 + 3;
+  int v189 = one * 1326 + 4;
+  int v190 = one * 1333 + 0;
+  int v191 = one * 1340 + 1;
+  int v192 = one * 1347 + 2;
+  int v193 = one * 1354 + 3;
+  int v194 = one * 1361 + 4;
+  int v195 = one * 1368 + 0;
+  int v196 = one * 1375 + 1;
+  int v197 = one * 1382 + 2;
+  int v198 = one * 1389 + 3;
+  int v199 = one * 1396 + 4;
+  int v200 = one * 1403 + 0;
+  int v201 = one * 1410 + 1;
+  int v202 = one * 1417 + 2;
+  int v203 = one * 1424 + 3;
+  int v204 = one * 1431 + 4;
+  int v205 = one * 1438 + 0;
+  int v206 = one * 1445 + 1;
+  int v207 = one * 1452 + 2;
+  int v208 = one * 1459 + 3;
+  int v209 = one * 1466 + 4;
+  int v210 = one * 1473 + 0;
+  int v211 = one * 1480 + 1;
+  int v212 = one * 1487 + 2;
+  int v213 = one * 1494 + 3;
+  int v214 = one * 1501 + 4;
+  int v215 = one * 1508 + 0;
+  int v216 = one * 1515 + 1;
+  int v217 = one * 1522 + 2;
+  int v218 = one * 1529 + 3;
+  int v219 = one * 1536 + 4;
+  int v220 = one * 1543 + 0;
+  int v221 = one * 1550 + 1;
+  int v222 = one * 1557 + 2;
+  int v223 = one * 1564 + 3;
+  int v224 = one * 1571 + 4;
+  int v225 = one * 1578 + 0;
+  int v226 = one * 1585 + 1;
+  int v227 = one * 1592 + 2;
+  int v228 = one * 1599 + 3;
+  int v229 = one * 1606 + 4;
+  int v230 = one * 1613 + 0;
+  int v231 = one * 1620 + 1;
+  int v232 = one * 1627 + 2;
+  int v233 = one * 1634 + 3;
+  int v234 = one * 1641 + 4;
+  int v235 = one * 1648 + 0;
+  int v236 = one * 1655 + 1;
+  int v237 = one * 1662 + 2;
+  int v238 = one * 1669 + 3;
+  int v239 = one * 1676 + 4;
+  int v240 = one * 1683 + 0;
+  int v241 = one * 1690 + 1;
+  int v242 = one * 1697 + 2;
+  int v243 = one * 1704 + 3;
+  int v244 = one * 1711 + 4;
+  int v245 = one * 1718 + 0;
+  int v246 = one * 1725 + 1;
+  int v247 = one * 1732 + 2;
+  int v248 = one * 1739 + 3;
+  int v249 = one * 1746 + 4;
+  int v250 = one * 1753 + 0;
+  int v251 = one * 1760 + 1;
+  int v252 = one * 1767 + 2;
+  int v253 = one * 1774 + 3;
+  int v254 = one * 1781 + 4;
+  int v255 = one * 1788 + 0;
+  int v256 = one * 1795 + 1;
+  int v257 = one * 1802 + 2;
+  int v258 = one * 1809 + 3;
+  int v259 = one * 1816 + 4;
+  int v260 = one * 1823 + 0;
+  int v261 = one * 1830 + 1;
+  int v262 = one * 1837 + 2;
+  int v263 = one * 1844 + 3;
+  int v264 = one * 1851 + 4;
+  int v265 = one * 1858 + 0;
+  int v266 = one * 1865 + 1;
+  int v267 = one * 1872 + 2;
+  int v268 = one * 1879 + 3;
+  int v269 = one * 1886 + 4;
+  int v270 = one * 1893 + 0;
+  int v271 = one * 1900 + 1;
+  int v272 = one * 1907 + 2;
+  int v273 = one * 1914 + 3;
+  int v274 = one * 1921 + 4;
+  int v275 = one * 1928 + 0;
+  int v276 = one * 1935 + 1;
+  int v277 = one * 1942 + 2;
+  int v278 = one * 1949 + 3;
+  int v279 = one * 1956 + 4;
+  int v280 = one * 1963 + 0;
+  int v281 = one * 1970 + 1;
+  int v282 = one * 1977 + 2;
+  int v283 = one * 1984 + 3;
+  int v284 = one * 1991 + 4;
+  int v285 = one * 1998 + 0;
+  int v286 = one * 2005 + 1;
+  int v287 = one * 2012 + 2;
+  int v288 = one * 2019 + 3;
+  int v289 = one * 2026 + 4;
+  int v290 = one * 2033 + 0;
+  int v291 = one * 2040 + 1;
+  int v292 = one * 2047 + 2;
+  int v293 = one * 2054 + 3;
+  int v294 = one * 2061 + 4;
+  int v295 = one * 2068 + 0;
+  int v296 = one * 2075 + 1;
+  int v297 = one * 2082 + 2;
+  int v298 = one * 2089 + 3;
+  int v299 = one * 2096 + 4;
+  int v300 = one * 2103 + 0;
+  int v301 = one * 2110 + 1;
+  int v302 = one * 2117 + 2;
+  int v303 = one * 2124 + 3;
+  int v304 = one * 2131 + 4;
+  int v305 = one * 2138 + 0;
+  int v306 = one * 2145 + 1;
+  int v307 = one * 2152 + 2;
+  int v308 = one * 2159 + 3;
+  int v309 = one * 2166 + 4;
+  int v310 = one * 2173 + 0;
+  int v311 = one * 2180 + 1;
+  int v312 = one * 2187 + 2;
+  int v313 = one * 2194 + 3;
+  int v314 = one * 2201 + 4;
+  int v315 = one * 2208 + 0;
+  int v316 = one * 2215 + 1;
+  int v317 = one * 2222 + 2;
+  int v318 = one * 2229 + 3;
+  int v319 = one * 2236 + 4;
+  int v320 = one * 2243 + 0;
+  int v321 = one * 2250 + 1;
+  int v322 = one * 2257 + 2;
+  int v323 = one * 2264 + 3;
+  int v324 = one * 2271 + 4;
+  int v325 = one * 2278 + 0;
+  int v326 = one * 2285 + 1;
+  int v327 = one * 2292 + 2;
+  int v328 = one * 2299 + 3;
+  int v329 = one * 2306 + 4;
+  int v330 = one * 2313 + 0;
+  int v331 = one * 2320 + 1;
+  int v332 = one * 2327 + 2;
+  int v333 = one * 2334 + 3;
+  int v334 = one * 2341 + 4;
+  int v335 = one * 2348 + 0;
+  int v336 = one * 2355 + 1;
+  int v337 = one * 2362 + 2;
+  int v338 = one * 2369 + 3;
+  int v339 = one * 2376 + 4;
+  int v340 = one * 2383 + 0;
+  int v341 = one * 2390 + 1;
+  int v342 = one * 2397 + 2;
+  int v343 = one * 2404 + 3;
+  int v344 = one * 2411 + 4;
+  int v345 = one * 2418 + 0;
+  int v346 = one * 2425 + 1;
+  int v347 = one * 2432 + 2;
+  int v348 = one * 2439 + 3;
+  int v349 = one * 2446 + 4;
+  int v350 = one * 2453 + 0;
+  int v351 = one * 2460 + 1;
+  int v352 = one * 2467 + 2;
+  int v353 = one * 2474 + 3;
+  int v354 = one * 2481 + 4;
+  int v355 = one * 2488 + 0;
+  int v356 = one * 2495 + 1;
+  int v357 = one * 2502 + 2;
+  int v358 = one * 2509 + 3;
+  int v359 = one * 2516 + 4;
+  int v360 = one * 2523 + 0;
+  int v361 = one * 2530 + 1;
+  int v362 = one * 2537 + 2;
+  int v363 = one * 2544 + 3;
+  int v364 = one * 2551 + 4;
+  int v365 = one * 2558 + 0;
+  int v366 = one * 2565 + 1;
+  int v367 = one * 2572 + 2;
+  int v368 = one * 2579 + 3;
+  int v369 = one * 2586 + 4;
+  int v370 = one * 2593 + 0;
+  int v371 = one * 2600 + 1;
+  int v372 = one * 2607 + 2;
+  int v373 = one * 2614 + 3;
+  int v374 = one * 2621 + 4;
+  int v375 = one * 2628 + 0;
+  int v376 = one * 2635 + 1;
+  int v377 = one * 2642 + 2;
+  int v378 = one * 2649 + 3;
+  int v379 = one * 2656 + 4;
+  int v380 = one * 2663 + 0;
+  int v381 = one * 2670 + 1;
+  int v382 = one * 2677 + 2;
+  int v383 = one * 2684 + 3;
+  int v384 = one * 2691 + 4;
+  int v385 = one * 2698 + 0;
+  int v386 = one * 2705 + 1;
+  int v387 = one * 2712 + 2;
+  int v388 = one * 2719 + 3;
+  int v389 = one * 2726 + 4;
+  int v390 = one * 2733 + 0;
+  int v391 = one * 2740 + 1;
+  int v392 = one * 2747 + 2;
+  int v393 = one * 2754 + 3;
+  int v394 = one * 2761 + 4;
+  int v395 = one * 2768 + 0;
+  int v396 = one * 2775 + 1;
+  int v397 = one * 2782 + 2;
+  int v398 = one * 2789 + 3;
+  int v399 = one * 2796 + 4;
+  int v400 = one * 2803 + 0;
+  int v401 = one * 2810 + 1;
+  int v402 = one * 2817 + 2;
+  int v403 = one * 2824 + 3;
+  int v404 = one * 2831 + 4;
+  int v405 = one * 2838 + 0;
+  int v406 = one * 2845 + 1;
+  int v407 = one * 2852 + 2;
+  int v408 = one * 2859 + 3;
+  int v409 = one * 2866 + 4;
+  int v410 = one * 2873 + 0;
+  int v411 = one * 2880 + 1;
+  int v412 = one * 2887 + 2;
+  int v413 = one * 2894 + 3;
+  int v414 = one * 2901 + 4;
+  int v415 = one * 2908 + 0;
+  int v416 = one * 2915 + 1;
+  int v417 = one * 2922 + 2;
+  int v418 = one * 2929 + 3;
+  int v419 = one * 2936 + 4;
+  int v420 = one * 2943 + 0;
+  int v421 = one * 2950 + 1;
+  int v422 = one * 2957 + 2;
+  int v423 = one * 2964 + 3;
+  int v424 = one * 2971 + 4;
+  int v425 = one * 2978 + 0;
+  int v426 = one * 2985 + 1;
+  int v427 = one * 2992 + 2;
+  int v428 = one * 2999 + 3;
+  int v429 = one * 3006 + 4;
+  int v430 = one * 3013 + 0;
+  int v431 = one * 3020 + 1;
+  int v432 = one * 3027 + 2;
+  int v433 = one * 3034 + 3;
+  int v434 = one * 3041 + 4;
+  int v435 = one * 3048 + 0;
+  int v436 = one * 3055 + 1;
+  int v437 = one * 3062 + 2;
+  int v438 = one * 3069 + 3;
+  int v439 = one * 3076 + 4;
+  int v440 = one * 3083 + 0;
+  int v441 = one * 3090 + 1;
+  int v442 = one * 3097 + 2;
+  int v443 = one * 3104 + 3;
+  int v444 = one * 3111 + 4;
+  int v445 = one * 3118 + 0;
+  int v446 = one * 3125 + 1;
+  int v447 = one * 3132 + 2;
+  int v448 = one * 3139 + 3;
+  int v449 = one * 3146 + 4;
+  int v450 = one * 3153 + 0;
+  int v451 = one * 3160 + 1;
+  int v452 = one * 3167 + 2;
+  int v453 = one * 3174 + 3;
+  int v454 = one * 3181 + 4;
+  int v455 = one * 3188 + 0;
+  int v456 = one * 3195 + 1;
+  int v457 = one * 3202 + 2;
+  int v458 = one * 3209 + 3;
+  int v459 = one * 3216 + 4;
+  int v460 = one * 3223 + 0;
+  int v461 = one * 3230 + 1;
+  int v462 = one * 3237 + 2;
+  int v463 = one * 3244 + 3;
+  int v464 = one * 3251 + 4;
+  int v465 = one * 3258 + 0;
+  int v466 = one * 3265 + 1;
+  int v467 = one * 3272 + 2;
+  int v468 = one * 3279 + 3;
+  int v469 = one * 3286 + 4;
+  int v470 = one * 3293 + 0;
+  int v471 = one * 3300 + 1;
+  int v472 = one * 3307 + 2;
+  int v473 = one * 3314 + 3;
+  int v474 = one * 3321 + 4;
+  int v475 = one * 3328 + 0;
+  int v476 = one * 3335 + 1;
+  int v477 = one * 3342 + 2;
+  int v478 = one * 3349 + 3;
+  int v479 = one * 3356 + 4;
+  int v480 = one * 3363 + 0;
+  int v481 = one * 3370 + 1;
+  int v482 = one * 3377 + 2;
+  int v483 = one * 3384 + 3;
+  int v484 = one * 3391 + 4;
+  int v485 = one * 3398 + 0;
+  int v486 = one * 3405 + 1;
+  int v487 = one * 3412 + 2;
+  int v488 = one * 3419 + 3;
+  int v489 = one * 3426 + 4;
+  int v490 = one * 3433 + 0;
+  int v491 = one * 3440 + 1;
+  int v492 = one * 3447 + 2;
+  int v493 = one * 3454 + 3;
+  int v494 = one * 3461 + 4;
+  int v495 = one * 3468 + 0;
+  int v496 = one * 3475 + 1;
+  int v497 = one * 3482 + 2;
+  int v498 = one * 3489 + 3;
+  int v499 = one * 3496 + 4;
+  int v500 = one * 3503 + 0;
+  int v501 = one * 3510 + 1;
+  int v502 = one * 3517 + 2;
+  int v503 = one * 3524 + 3;
+  int v504 = one * 3531 + 4;
+  int v505 = one * 3538 + 0;
+  int v506 = one * 3545 + 1;
+  int v507 = one * 3552 + 2;
+  int v508 = one * 3559 + 3;
+  int v509 = one * 3566 + 4;
+  int v510 = one * 3573 + 0;
+  int v511 = one * 3580 + 1;
+  int v512 = one * 3587 + 2;
+  int v513 = one * 3594 + 3;
+  int v514 = one * 3601 + 4;
+  int v515 = one * 3608 + 0;
+  int v516 = one * 3615 + 1;
+  int v517 = one * 3622 + 2;
+  int v518 = one * 3629 + 3;
+  int v519 = one * 3636 + 4;
+  int v520 = one * 3643 + 0;
+  int v521 = one * 3650 + 1;
+  int v522 = one * 3657 + 2;
+  int v523 = one * 3664 + 3;
+  int v524 = one * 3671 + 4;
+  int v525 = one * 3678 + 0;
+  int v526 = one * 3685 + 1;
+  int v527 = one * 3692 + 2;
+  int v528 = one * 3699 + 3;
+  int v529 = one * 3706 + 4;
+  int v530 = one * 3713 + 0;
+  int v531 = one * 3720 + 1;
+  int v532 = one * 3727 + 2;
+  int v533 = one * 3734 + 3;
+  int v534 = one * 3741 + 4;
+  int v535 = one * 3748 + 0;
+  int v536 = one * 3755 + 1;
+  int v537 = one * 3762 + 2;
+  int v538 = one * 3769 + 3;
+  int v539 = one * 3776 + 4;
+  int v540 = one * 3783 + 0;
+  int v541 = one * 3790 + 1;
+  int v542 = one * 3797 + 2;
+  int v543 = one * 3804 + 3;
+  int v544 = one * 3811 + 4;
+  int v545 = one * 3818 + 0;
+  int v546 = one * 3825 + 1;
+  int v547 = one * 3832 + 2;
+  int v548 = one * 3839 + 3;
+  int v549 = one * 3846 + 4;
+  int v550 = one * 3853 + 0;
+  int v551 = one * 3860 + 1;
+  int v552 = one * 3867 + 2;
+  int v553 = one * 3874 + 3;
+  int v554 = one * 3881 + 4;
+  int v555 = one * 3888 + 0;
+  int v556 = one * 3895 + 1;
+  int v557 = one * 3902 + 2;
+  int v558 = one * 3909 + 3;
+  int v559 = one * 3916 + 4;
+  int v560 = one * 3923 + 0;
+  int v561 = one * 3930 + 1;
+  int v562 = one * 3937 + 2;
+  int v563 = one * 3944 + 3;
+  int v564 = one * 3951 + 4;
+  int v565 = one * 3958 + 0;
+  int v566 = one * 3965 + 1;
+  int v567 = one * 3972 + 2;
+  int v568 = one * 3979 + 3;
+  int v569 = one * 3986 + 4;
+  int v570 = one * 3993 + 0;
+  int v571 = one * 4000 + 1;
+  int v572 = one * 4007 + 2;
+  int v573 = one * 4014 + 3;
+  int v574 = one * 4021 + 4;
+  int v575 = one * 4028 + 0;
+  int v576 = one * 4035 + 1;
+  int v577 = one * 4042 + 2;
+  int v578 = one * 4049 + 3;
+  int v579 = one * 4056 + 4;
+  int v580 = one * 4063 + 0;
+  int v581 = one * 4070 + 1;
+  int v582 = one * 4077 + 2;
+  int v583 = one * 4084 + 3;
+  int v584 = one * 4091 + 4;
+  int v585 = one * 4098 + 0;
+  int v586 = one * 4105 + 1;
+  int v587 = one * 4112 + 2;
+  int v588 = one * 4119 + 3;
+  int v589 = one * 4126 + 4;
+  int v590 = one * 4133 + 0;
+  int v591 = one * 4140 + 1;
+  int v592 = one * 4147 + 2;
+  int v593 = one * 4154 + 3;
+  int v594 = one * 4161 + 4;
+  int v595 = one * 4168 + 0;
+  int v596 = one * 4175 + 1;
+  int v597 = one * 4182 + 2;
+  int v598 = one * 4189 + 3;
+  int v599 = one * 4196 + 4;
+  int sum = 0;
+  sum = sum - v0;
+  sum = sum + v1;
+  sum = sum + v2;
+  sum = sum - v3;
+  sum = sum + v4;
+  sum = sum + v5;
+  sum = sum - v6;
+  sum = sum + v7;
+  sum = sum + v8;
+  sum = sum - v9;
+  sum = sum + v10;
+  sum = sum + v11;
+  sum = sum - v12;
+  sum = sum + v13;
+  sum = sum + v14;
+  sum = sum - v15;
+  sum = sum + v16;
+  sum = sum + v17;
+  sum = sum - v18;
+  sum = sum + v19;
+  sum = sum + v20;
+  sum = sum - v21;
+  sum = sum + v22;
+  sum = sum + v23;
+  sum = sum - v24;
+  sum = sum + v25;
+  sum = sum + v26;
+  sum = sum - v27;
+  sum = sum + v28;
+  sum = sum + v29;
+  sum = sum - v30;
+  sum = sum + v31;
+  sum = sum + v32;
+  sum = sum - v33;
+  sum = sum + v34;
+  sum = sum + v35;
+  sum = sum - v36;
+  sum = sum + v37;
+  sum = sum + v38;
+  sum = sum - v39;
+  sum = sum + v40;
+  sum = sum + v41;
+  sum = sum - v42;
+  sum = sum + v43;
+  sum = sum + v44;
+  sum = sum - v45;
+  sum = sum + v46;
+  sum = sum + v47;
+  sum = sum - v48;
+  sum = sum + v49;
+  sum = sum + v50;
+  sum = sum - v51;
+  sum = sum + v52;
+  sum = sum + v53;
+  sum = sum - v54;
+  sum = sum + v55;
+  sum = sum + v56;
+  sum = sum - v57;
+  sum = sum + v58;
+  sum = sum + v59;
+  sum = sum - v60;
+  sum = sum + v61;
+  sum = sum + v62;
+  sum = sum - v63;
+  sum = sum + v64;
+  sum = sum + v65;
+  sum = sum - v66;
+  sum = sum + v67;
+  sum = sum + v68;
+  sum = sum - v69;
+  sum = sum + v70;
+  sum = sum + v71;
+  sum = sum - v72;
+  sum = sum + v73;
+  sum = sum + v74;
+  sum = sum - v75;
+  sum = sum + v76;
+  sum = sum + v77;
+  sum = sum - v78;
+  sum = sum + v79;
+  sum = sum + v80;
+  sum = sum - v81;
+  sum = sum + v82;
+  sum = sum + v83;
+  sum = sum - v84;
+  sum = sum + v85;
+  sum = sum + v86;
+  sum = sum - v87;
+  sum = sum + v88;
+  sum = sum + v89;
+  sum = sum - v90;
+  sum = sum + v91;
+  sum = sum + v92;
+  sum = sum - v93;
+  sum = sum + v94;
+  sum = sum + v95;
+  sum = sum - v96;
+  sum = sum + v97;
+  sum = sum + v98;
+  sum = sum - v99;
+  sum = sum + v100;
+  sum = sum + v101;
+  sum = sum - v102;
+  sum = sum + v103;
+  sum = sum + v104;
+  sum = sum - v105;
+  sum = sum + v106;
+  sum = sum + v107;
+  sum = sum - v108;
+  sum = sum + v109;
+  sum = sum + v110;
+  sum = sum - v111;
+  sum = sum + v112;
+  sum = sum + v113;
+  sum = sum - v114;
+  sum = sum + v115;
+  sum = sum + v116;
+  sum = sum - v117;
+  sum = sum + v118;
+  sum = sum + v119;
+  sum = sum - v120;
+  sum = sum + v121;
+  sum = sum + v122;
+  sum = sum - v123;
+  sum = sum + v124;
+  sum = sum + v125;
+  sum = sum - v126;
+  sum = sum + v127;
+  sum = sum + v128;
+  sum = sum - v129;
+  sum = sum + v130;
+  sum = sum + v131;
+  sum = sum - v132;
+  sum = sum + v133;
+  sum = sum + v134;
+  sum = sum - v135;
+  sum = sum + v136;
+  sum = sum + v137;
+  sum = sum - v138;
+  sum = sum + v139;
+  sum = sum + v140;
+  sum = sum - v141;
+  sum = sum + v142;
+  sum = sum + v143;
+  sum = sum - v144;
+  sum = sum + v145;
+  sum = sum + v146;
+  sum = sum - v147;
+  sum = sum + v148;
+  sum = sum + v149;
+  sum = sum - v150;
+  sum = sum + v151;
+  sum = sum + v152;
+  sum = sum - v153;
+  sum = sum + v154;
+  sum = sum + v155;
+  sum = sum - v156;
+  sum = sum + v157;
+  sum = sum + v158;
+  sum = sum - v159;
+  sum = sum + v160;
+  sum = sum + v161;
+  sum = sum - v162;
+  sum = sum + v163;
+  sum = sum + v164;
+  sum = sum - v165;
+  sum = sum + v166;
+  sum = sum + v167;
+  sum = sum - v168;
+  sum = sum + v169;
+  sum = sum + v170;
+  sum = sum - v171;
+  sum = sum + v172;
+  sum = sum + v173;
+  sum = sum - v174;
+  sum = sum + v175;
+  sum = sum + v176;
+  sum = sum - v177;
+  sum = sum + v178;
+  sum = sum + v179;
+  sum = sum - v180;
+  sum = sum + v181;
+  sum = sum + v182;
+  sum = sum - v183;
+  sum = sum + v184;
+  sum = sum + v185;
+  sum = sum - v186;
+  sum = sum + v187;
+  sum = sum + v188;
+  sum = sum - v189;
+  sum = sum + v190;
+  sum = sum + v191;
+  sum = sum - v192;
+  sum = sum + v193;
+  sum = sum + v194;
+  sum = sum - v195;
+  sum = sum + v196;
+  sum = sum + v197;
+  sum = sum - v198;
+  sum = sum + v199;
+  sum = sum + v200;
+  sum = sum - v201;
+  sum = sum + v202;
+  sum = sum + v203;
+  sum = sum - v204;
+  sum = sum + v205;
+  sum = sum + v206;
+  sum = sum - v207;
+  sum = sum + v208;
+  sum = sum + v209;
+  sum = sum - v210;
+  sum = sum + v211;
+  sum = sum + v212;
+  sum = sum - v213;
+  sum = sum + v214;
+  sum = sum + v215;
+  sum = sum - v216;
+  sum = sum + v217;
+  sum = sum + v218;
+  sum = sum - v219;
+  sum = sum + v220;
+  sum = sum + v221;
+  sum = sum - v222;
+  sum = sum + v223;
+  sum = sum + v224;
+  sum = sum - v225;
+  sum = sum + v226;
+  sum = sum + v227;
+  sum = sum - v228;
+  sum = sum + v229;
+  sum = sum + v230;
+  sum = sum - v231;
+  sum = sum + v232;
+  sum = sum + v233;
+  sum = sum - v234;
+  sum = sum + v235;
+  sum = sum + v236;
+  sum = sum - v237;
+  sum = sum + v238;
+  sum = sum + v239;
+  sum = sum - v240;
+  sum = sum + v241;
+  sum = sum + v242;
+  sum = sum - v243;
+  sum = sum + v244;
+  sum = sum + v245;
+  sum = sum - v246;
+  sum = sum + v247;
+  sum = sum + v248;
+  sum = sum - v249;
+  sum = sum + v250;
+  sum = sum + v251;
+  sum = sum - v252;
+  sum = sum + v253;
+  sum = sum + v254;
+  sum = sum - v255;
+  sum = sum + v256;
+  sum = sum + v257;
+  sum = sum - v258;
+  sum = sum + v259;
+  sum = sum + v260;
+  sum = sum - v261;
+  sum = sum + v262;
+  sum = sum + v263;
+  sum = sum - v264;
+  sum = sum + v265;
+  sum = sum + v266;
+  sum = sum - v267;
+  sum = sum + v268;
+  sum = sum + v269;
+  sum = sum - v270;
+  sum = sum + v271;
+  sum = sum + v272;
+  sum = sum - v273;
+  sum = sum + v274;
+  sum = sum + v275;
+  sum = sum - v276;
+  sum = sum + v277;
+  sum = sum + v278;
+  sum = sum - v279;
+  sum = sum + v280;
+  sum = sum + v281;
+  sum = sum - v282;
+  sum = sum + v283;
+  sum = sum + v284;
+  sum = sum - v285;
+  sum = sum + v286;
+  sum = sum + v287;
+  sum = sum - v288;
+  sum = sum + v289;
+  sum = sum + v290;
+  sum = sum - v291;
+  sum = sum + v292;
+  sum = sum + v293;
+  sum = sum - v294;
+  sum = sum + v295;
+  sum = sum + v296;
+  sum = sum - v297;
+  sum = sum + v298;
+  sum = sum + v299;
+  sum = sum - v300;
+  sum = sum + v301;
+  sum = sum + v302;
+  sum = sum - v303;
+  sum = sum + v304;
+  sum = sum + v305;
+  sum = sum - v306;
+  sum = sum + v307;
+  sum = sum + v308;
+  sum = sum - v309;
+  sum = sum + v310;
+  sum = sum + v311;
+  sum = sum - v312;
+  sum = sum + v313;
+  sum = sum + v314;
+  sum = sum - v315;
+  sum = sum + v316;
+  sum = sum + v317;
+  sum = sum - v318;
+  sum = sum + v319;
+  sum = sum + v320;
+  sum = sum - v321;
+  sum = sum + v322;
+  sum = sum + v323;
+  sum = sum - v324;
+  sum = sum + v325;
+  sum = sum + v326;
+  sum = sum - v327;
+  sum = sum + v328;
+  sum = sum + v329;
+  sum = sum - v330;
+  sum = sum + v331;
+  sum = sum + v332;
+  sum = sum - v333;
+  sum = sum + v334;
+  sum = sum + v335;
+  sum = sum - v336;
+  sum = sum + v337;
+  sum = sum + v338;
+  sum = sum - v339;
+  sum = sum + v340;
+  sum = sum + v341;
+  sum = sum - v342;
+  sum = sum + v343;
+  sum = sum + v344;
+  sum = sum - v345;
+  sum = sum + v346;
+  sum = sum + v347;
+  sum = sum - v348;
+  sum = sum + v349;
+  sum = sum + v350;
+  sum = sum - v351;
+  sum = sum + v352;
+  sum = sum + v353;
+  sum = sum - v354;
+  sum = sum + v355;
+  sum = sum + v356;
+  sum = sum - v357;
+  sum = sum + v358;
+  sum = sum + v359;
+  sum = sum - v360;
+  sum = sum + v361;
+  sum = sum + v362;
+  sum = sum - v363;
+  sum = sum + v364;
+  sum = sum + v365;
+  sum = sum - v366;
+  sum = sum + v367;
+  sum = sum + v368;
+  sum = sum - v369;
+  sum = sum + v370;
+  sum = sum + v371;
+  sum = sum - v372;
+  sum = sum + v373;
+  sum = sum + v374;
+  sum = sum - v375;
+  sum = sum + v376;
+  sum = sum + v377;
+  sum = sum - v378;
+  sum = sum + v379;
+  sum = sum + v380;
+  sum = sum - v381;
+  sum = sum + v382;
+  sum = sum + v383;
+  sum = sum - v384;
+  sum = sum + v385;
+  sum = sum + v386;
+  sum = sum - v387;
+  sum = sum + v388;
+  sum = sum + v389;
+  sum = sum - v390;
+  sum = sum + v391;
+  sum = sum + v392;
+  sum = sum - v393;
+  sum = sum + v394;
+  sum = sum + v395;
+  sum = sum - v396;
+  sum = sum + v397;
+  sum = sum + v398;
+  sum = sum - v399;
+  sum = sum + v400;
+  sum = sum + v401;
+  sum = sum - v402;
+  sum = sum + v403;
+  sum = sum + v404;
+  sum = sum - v405;
+  sum = sum + v406;
+  sum = sum + v407;
+  sum = sum - v408;
+  sum = sum + v409;
+  sum = sum + v410;
+  sum = sum - v411;
+  sum = sum + v412;
+  sum = sum + v413;
+  sum = sum - v414;
+  sum = sum + v415;
+  sum = sum + v416;
+  sum = sum - v417;
+  sum = sum + v418;
+  sum = sum + v419;
+  sum = sum - v420;
+  sum = sum + v421;
+  sum = sum + v422;
+  sum = sum - v423;
+  sum = sum + v424;
+  sum = sum + v425;
+  sum = sum - v426;
+  sum = sum + v427;
+  sum = sum + v428;
+  sum = sum - v429;
+  sum = sum + v430;
+  sum = sum + v431;
+  sum = sum - v432;
+  sum = sum + v433;
+  sum = sum + v434;
+  sum = sum - v435;
+  sum = sum + v436;
+  sum = sum + v437;
+  sum = sum - v438;
+  sum = sum + v439;
+  sum = sum + v440;
+  sum = sum - v441;
+  sum = sum + v442;
+  sum = sum + v443;
+  sum = sum - v444;
+  sum = sum + v445;
+  sum = sum + v446;
+  sum = sum - v447;
+  sum = sum + v448;
+  sum = sum + v449;
+  sum = sum - v450;
+  sum = sum + v451;
+  sum = sum + v452;
+  sum = sum - v453;
+  sum = sum + v454;
+  sum = sum + v455;
+  sum = sum - v456;
+  sum = sum + v457;
+  sum = sum + v458;
+  sum = sum - v459;
+  sum = sum + v460;
+  sum = sum + v461;
+  sum = sum - v462;
+  sum = sum + v463;
+  sum = sum + v464;
+  sum = sum - v465;
+  sum = sum + v466;
+  sum = sum + v467;
+  sum = sum - v468;
+  sum = sum + v469;
+  sum = sum + v470;
+  sum = sum - v471;
+  sum = sum + v472;
+  sum = sum + v473;
+  sum = sum - v474;
+  sum = sum + v475;
+  sum = sum + v476;
+  sum = sum - v477;
+  sum = sum + v478;
+  sum = sum + v479;
+  sum = sum - v480;
+  sum = sum + v481;
+  sum = sum + v482;
+  sum = sum - v483;
+  sum = sum + v484;
+  sum = sum + v485;
+  sum = sum - v486;
+  sum = sum + v487;
+  sum = sum + v488;
+  sum = sum - v489;
+  sum = sum + v490;
+  sum = sum + v491;
+  sum = sum - v492;
+  sum = sum + v493;
+  sum = sum + v494;
+  sum = sum - v495;
+  sum = sum + v496;
+  sum = sum + v497;
+  sum = sum - v498;
+  sum = sum + v499;
+  sum = sum + v500;
+  sum = sum - v501;
+  sum = sum + v502;
+  sum = sum + v503;
+  sum = sum - v504;
+  sum = sum + v505;
+  sum = sum + v506;
+  sum = sum - v507;
+  sum = sum + v508;
+  sum = sum + v509;
+  sum = sum - v510;
+  sum = sum + v511;
+  sum = sum + v512;
+  sum = sum - v513;
+  sum = sum + v514;
+  sum = sum + v515;
+  sum = sum - v516;
+  sum = sum + v517;
+  sum = sum + v518;
+  sum = sum - v519;
+  sum = sum + v520;
+  sum = sum + v521;
+  sum = sum - v522;
+  sum = sum + v523;
+  sum = sum + v524;
+  sum = sum - v525;
+  sum = sum + v526;
+  sum = sum + v527;
+  sum = sum - v528;
+  sum = sum + v529;
+  sum = sum + v530;
+  sum = sum - v531;
+  sum = sum + v532;
+  sum = sum + v533;
+  sum = sum - v534;
+  sum = sum + v535;
+  sum = sum + v536;
+  sum = sum - v537;
+  sum = sum + v538;
+  sum = sum + v539;
+  sum = sum - v540;
+  sum = sum + v541;
+  sum = sum + v542;
+  sum = sum - v543;
+  sum = sum + v544;
+  sum = sum + v545;
+  sum = sum - v546;
+  sum = sum + v547;
+  sum = sum + v548;
+  sum = sum - v549;
+  sum = sum + v550;
+  sum = sum + v551;
+  sum = sum - v552;
+  sum = sum + v553;
+  sum = sum + v554;
+  sum = sum - v555;
+  sum = sum + v556;
+  sum = sum + v557;
+  sum = sum - v558;
+  sum = sum + v559;
+  sum = sum + v560;
+  sum = sum - v561;
+  sum = sum + v562;
+  sum = sum + v563;
+  sum = sum - v564;
+  sum = sum + v565;
+  sum = sum + v566;
+  sum = sum - v567;
+  sum = sum + v568;
+  sum = sum + v569;
+  sum = sum - v570;
+  sum = sum + v571;
+  sum = sum + v572;
+  sum = sum - v573;
+  sum = sum + v574;
+  sum = sum + v575;
+  sum = sum - v576;
+  sum = sum + v577;
+  sum = sum + v578;
+  sum = sum - v579;
+  sum = sum + v580;
+  sum = sum + v581;
+  sum = sum - v582;
+  sum = sum + v583;
+  sum = sum + v584;
+  sum = sum - v585;
+  sum = sum + v586;
+  sum = sum + v587;
+  sum = sum - v588;
+  sum = sum + v589;
+  sum = sum + v590;
+  sum = sum - v591;
+  sum = sum + v592;
+  sum = sum + v593;
+  sum = sum - v594;
+  sum = sum + v595;
+  sum = sum + v596;
+  sum = sum - v597;
+  sum = sum + v598;
+  sum = sum + v599;
+  return sum;
+}
@@ -0,0 +1,29 @@
+// 比较运算和逻辑非, 包括 GVN 会交换操作数的 > 和 >=
+int main() {
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int a = one * 5;
+  int b = one * -3;
+  int c = one * 5;
+  int r = 0;
+  r = r * 2 + (a < b);
+  r = r * 2 + (a > b);
+  r = r * 2 + (b < a);
+  r = r * 2 + (b > a);
+  r = r * 2 + (a <= c);
+  r = r * 2 + (a >= c);
+  r = r * 2 + (a < c);
+  r = r * 2 + (a > c);
+  r = r * 2 + (a == c);
+  r = r * 2 + (a != c);
+  r = r * 2 + (a == b);
+  r = r * 2 + (a != b);
+  r = r * 2 + !a;
+  r = r * 2 + !(a - c);
+  r = r * 2 + !!b;
+  r = r * 2 + (b <= -3);
+  r = r * 2 + (b >= -2);
+  r = r * 2 + (a < 2048);
+  r = r * 2 + (a > -2049);
+  return r;
+}
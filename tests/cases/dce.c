@@ -0,0 +1,19 @@
+// 值没有被用到的表达式语句和只写不读的变量会被删除, 但用到的值不能删除
+int main() {
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int unused = one * 100;
+  unused = unused + 1;
+  one * 5 + 3;
+  s / one;
+  ;
+  int w;
+  w = one + 2;
+  w = one + 3;
+  {
+    int unused = w * 2;
+    w = unused + w;
+  }
+  const int c = 12;
+  return w + c;
+}
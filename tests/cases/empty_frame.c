@@ -0,0 +1,4 @@
+// 没有局部变量的函数栈帧为空, prologue 和 epilogue 不需要移动 sp
+int main() {
+  return 3;
+}
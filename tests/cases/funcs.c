@@ -0,0 +1,23 @@
+// 多个函数: 每个函数单独生成 IR 和代码, 栈帧和基本块编号互不影响
+int f0() {
+  int a = 1;
+  int b = a + 2;
+  return a * b;
+}
+
+int f1() {
+  int s = 5;
+  int one = s != 0 && 5 / s > 0;
+  return one || 10 / s;
+}
+
+int main() {
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int x = one * 42;
+  return x;
+}
+
+int f2() {
+  return 0;
+}
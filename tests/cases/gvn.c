@@ -0,0 +1,25 @@
+// 重复的表达式只计算一次; 可交换的运算交换操作数后相同, 不可交换的 (a - b 和 b - a, a < b 和 b < a) 不能合并
+int main() {
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int a = one * 11;
+  int b = one * 4;
+  int p = a + b;
+  int q = b + a;
+  int m = a - b;
+  int n = b - a;
+  int d = a / b;
+  int e = b / a;
+  int f = a % b;
+  int g = b % a;
+  int l = a < b;
+  int h = b < a;
+  int k = a > b;
+  int t = a * b + b * a;
+  {
+    int a = one * 2;
+    int u = a + b;
+    p = p * 10 + u;
+  }
+  return p * 1000000 + q * 10000 + (m * 100 + n) * 10 + d + e + f * 3 + g * 5 + l + h * 2 + k * 4 + t;
+}
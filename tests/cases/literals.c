@@ -0,0 +1,20 @@
+// 十六进制和八进制常量, 以及 12 位立即数边界附近的常量
+int main() {
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int x = one * 1000;
+  int r = 0;
+  r = r + (x + 2047);
+  r = r + (x + 2048);
+  r = r + (x - 2048);
+  r = r + (x - 2049);
+  r = r + (x + -2048);
+  r = r * 3 + 0x7fffffff;
+  r = r + 0XaB;
+  r = r - 017;
+  r = r + 0;
+  r = r + 2147483647 * one;
+  r = r + (x < 2047) + (x < 2048) + (x > -2048) + (x > -2049);
+  r = r + 65536 + 0x10000 + 0200000;
+  return r;
+}
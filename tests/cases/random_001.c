@@ -0,0 +1,18 @@
+int main() {
+  {
+    int x3 = +(((3 <= 0) + -(8))), v0 = (((x3 + x3) <= x3) || ((2147483647 * 65536) > (x3 < x3)));
+    {
+      {
+        x3 = (((10 || v0) <= (0 || 2147483647)) || ((x3 && 4096) + (v0 || x3)));
+        {
+          int b0 = (0x2 >= v0), b2 = (x3 * ((v0 * v0) == (2147483647 >= 4096))), a1 = 7;
+          b2 = (((0x1000 != v0) + (b0 * 4096)) && x3);
+          v0 = ((x3 && (b2 + b2)) < ((v0 == 5) != (2047 || 65536)));
+          x3 = +(b0);
+          return (+((a1 * 0x64)) && 5);
+          (a1 || b0);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,4 @@
+int main() {
+  const int b2 = ((2048 + 2147483647) - (1 >= 2047)), c3 = ((b2 + b2) < (12345 < 2047));
+  return (12345 - (((c3 - b2) && (12 < c3)) * ((b2 + c3) && (100 * 8))));
+}
@@ -0,0 +1,5 @@
+int main() {
+  const int x0 = ((65536 * 5) * 2147483647), a0 = 1, a2 = ((12345 || a0) || x0);
+  int x2 = (((7 >= a2) != (12 > a2)) || +((a0 == 1))), a3 = ((x0 == (5 == 100)) >= ((3 || 2147483647) || (a2 == a2)));
+  return (5 || ((a2 / (a0 < 12345)) <= (a0 != 0 && (100 < 2047) / a0)));
+}
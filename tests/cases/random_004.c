@@ -0,0 +1,7 @@
+int main() {
+  int x3 = 2048, c0 = (((x3 >= x3) + 2048) < x3), y2 = (((c0 - x3) + c0) == (2 != (c0 >= 100)));
+  int a0 = (16 <= 16);
+  int b3, y0 = c0;
+  int b2 = (((c0 > x3) == c0) && ((y0 == 0 || a0 / y0) <= (x3 - a0)));
+  return y2;
+}
@@ -0,0 +1,12 @@
+int main() {
+  int v0, b0;
+  const int b3 = ((04000 < 02) + (0 + 8)), b1 = ((8 < 0x10) || (b3 >= 0));
+  ;
+  const int c3 = ((b3 != 0 && 2047 / b3) * (b3 + 010));
+  int y2 = 2047, a3;
+  const int b2 = ((5 < b1) * c3);
+  a3 = 2047;
+  b0 = 1;
+  -((c3 == 0 || c3 / c3));
+  return (((!(65536) || y2) != (2047 && (a3 && c3))) && (((y2 != 0 && 100 / y2) < (a3 && b2)) == ((017777777777 && 8) < (010000 * 2147483647))));
+}
@@ -0,0 +1,23 @@
+int main() {
+  {
+    {
+      const int y3 = ((4096 > 03) != (2 >= 100)), c3 = ((y3 == y3) / (8 * 2147483647)), a2 = (!(y3) && (y3 > y3));
+    }
+    {
+      int a2 = (((4096 < 0x800) % (12345 * 2048)) && ((12345 >= 0x7) + (8 && 12345)));
+      a2 = (((a2 * a2) * (12 || a2)) * ((a2 - 2047) == (5 - 4096)));
+      {
+        a2 = ((3 != a2) % ((12 < 12345) % 8));
+        a2 = (((a2 * a2) && (10 - 1)) * (a2 != 0 && (a2 * a2) / a2));
+        a2 = a2;
+        int b1 = a2, v1 = a2;
+        a2 = (((v1 && a2) && (a2 && 7)) > a2);
+        const int a0 = ((0x10 <= 2) - (3 - 0x7));
+        {
+          v1 = ((v1 != 0 && v1 / v1) - (b1 % (a0 + 014)));
+          return b1;
+        }
+      }
+    }
+  }
+}
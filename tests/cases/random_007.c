@@ -0,0 +1,7 @@
+int main() {
+  const int a2 = (4096 > (3 - 1)), x0 = (a2 != 0 && (a2 / a2) / a2), y0 = ((x0 != a2) * (x0 <= x0));
+  ;
+  int a3 = (100 + (x0 - (16 - 12345)));
+  a3 = x0;
+  return (((y0 * (a3 || 2048)) <= x0) > (x0 == 0 || (a3 == 0 || (2147483647 != 1) / a3) / x0));
+}
@@ -0,0 +1,5 @@
+int main() {
+  int a1 = (((2 || 0) * (3 || 3)) + 04000);
+  const int v0 = ((1 * 010) > (16 - 010000));
+  return !((((2147483647 * v0) % (v0 != 0 && a1 / v0)) * (a1 + (a1 + a1))));
+}
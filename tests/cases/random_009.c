@@ -0,0 +1,9 @@
+int main() {
+  ((100 * 1) + 12345);
+  int a1 = (((2 + 8) == !(0)) || 2048);
+  const int x0 = !(8);
+  const int y0 = ((05 * 0x1) > (01 % 012));
+  a1 = (!((0 > 0)) * ((a1 == y0) != (a1 <= a1)));
+  const int y2 = ((x0 >= x0) % (y0 + y0)), c0 = ((16 * y0) % y0);
+  return ((((x0 * 010) >= (c0 || y0)) * ((c0 + a1) + (x0 == 0x3))) >= !(((c0 <= 0xa) + (a1 + a1))));
+}
@@ -0,0 +1,23 @@
+int main() {
+  const int y0 = ((65536 && 10) >= (5 + 2048)), v2 = (10 && (y0 == 0 || y0 / y0));
+  int b2 = (((100 || v2) && (65536 || v2)) < (04000 * (y0 || y0))), x0;
+  b2 = y0;
+  ((100 && 12345) % (100 % 0x10000));
+  const int x1 = ((020 / v2) - (0x7 > y0)), a2 = ((x1 || x1) && (v2 == 0 || 2048 / v2));
+  const int a0 = ((x1 == x1) + (65536 && 0x10000)), y2 = ((x1 * x1) < -(16));
+  int b0;
+  int c1 = ((x1 - (y2 < 0x7)) != (b2 && 12345));
+  ((2147483647 != y2) < (b2 == 0 || 8 / b2));
+  {
+    b2 = (a0 <= ((x1 * b2) - (100 - b2)));
+    b0 = 2048;
+    b2 = (0x7fffffff && (y2 != 0 && (b0 - 0x7) / y2));
+    int x3;
+    {
+      const int a1 = y0;
+      ((12345 - y2) + (5 && b0));
+      const int a2 = y0, c2 = ((1 - v2) && 010000);
+    }
+  }
+  return v2;
+}
@@ -0,0 +1,44 @@
+int main() {
+  {
+    {
+      int x1 = !(((0 < 0x2) || 10)), x2 = (((2 || x1) - (x1 != 0 && x1 / x1)) == ((x1 - x1) + (x1 * 03))), v0 = 16;
+      const int y1 = 2047;
+      v0 = (x2 || (8 > (x1 * v0)));
+      int x3 = 02, x0 = (x2 + v0);
+    }
+    const int x2 = 0x2;
+    ((x2 - x2) != +(x2));
+    ((x2 > 12345) + (x2 >= 8));
+  }
+  int b3 = +((65536 < (65536 && 12345)));
+  {
+    {
+      ((b3 > b3) + (b3 / 010));
+    }
+    b3 = (((b3 && b3) >= 04000) || ((100 && 0x8) + (b3 / 16)));
+    {
+      int a2 = b3, c3, b0 = b3;
+      c3 = (((b0 < b0) || (b3 > 2147483647)) * ((b3 + a2) / (b0 / b0)));
+      b0 = (((2047 <= c3) || (5 > b3)) || -((b3 > c3)));
+      const int v2 = ((1 + 2147483647) > (010 / 7)), v0 = (v2 - (v2 + v2)), b1 = ((v2 < v2) && (v2 || v0));
+    }
+    {
+      int v1;
+      v1 = ((b3 < 1) + ((b3 < b3) != (0 || b3)));
+      int y0 = (v1 == 0 || ((b3 && 2) || (7 || 65536)) / v1), x3 = (((b3 == y0) >= 0x800) && (4096 != (y0 - 5)));
+      {
+        ;
+        const int x0 = !(2047), v3 = ((012 > x0) && (x0 != 0 && x0 / x0));
+        b3;
+        {
+          int v2 = (((v3 > v1) * (v3 != 7)) * -(x0));
+          x3 = (((v3 && x3) && (5 && v1)) == v2);
+          int b0 = (v2 + ((v3 * v3) >= (x0 <= x3)));
+          y0 = (((2047 + 2) * (b3 && 4096)) % ((v2 < x0) < (v1 * y0)));
+          return b0;
+          (x3 != (x3 * x0));
+        }
+      }
+    }
+  }
+}
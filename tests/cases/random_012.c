@@ -0,0 +1,10 @@
+int main() {
+  int v2 = 2047, v3 = (((v2 == 0 || v2 / v2) != +(2147483647)) % (v2 - (v2 || v2))), x3 = (8 || ((v2 == v3) && (v3 && 0x1000)));
+  const int x0 = ((0xc * 12) / (12345 && 100)), b1 = (0 < (x0 < x0));
+  (12 && (x3 * x0));
+  int y0 = (((v2 != 0 && 5 / v2) == x0) - ((8 * x3) >= (v3 < 1))), x1 = -(y0);
+  ((v2 || x3) > y0);
+  const int c1 = ((b1 == 0 || 0200000 / b1) + (x0 != b1)), c2 = ((0144 && c1) == (x0 - 10));
+  ((b1 || v2) - (07 && c2));
+  return x1;
+}
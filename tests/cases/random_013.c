@@ -0,0 +1,30 @@
+int main() {
+  int b1 = (8 < 5), y0, b0;
+  {
+    {
+      b1 = (((b1 || b1) < (12345 || 0x7fffffff)) && ((2147483647 * 0) == b1));
+      int c0 = (((16 && 0x1000) > +(b1)) % ((b1 != 5) - 8));
+      ((c0 + b1) / (0 || 0x5));
+      const int b0 = ((8 - 1) <= +(2047)), c1 = ((3 < b0) * (b0 + 01));
+      int x3 = (((2047 <= 65536) >= c1) + c1);
+      b1 = (c0 % 2147483647);
+      const int v3 = b0, v0 = ((b0 == 0 || v3 / b0) >= (1 != 10));
+      ;
+      const int x2 = ((5 >= b0) <= (v0 && 2048));
+      y0 = 2147483647;
+      int a1 = -(((b1 + c0) + c1)), y1 = (y0 == 0 || ((b1 != b0) * a1) / y0), b3 = 0x7;
+    }
+    const int b1 = -(!(010000)), x1 = (2 / (b1 >= 0));
+    const int b3 = (x1 == 0 || (b1 > x1) / x1), y3 = ((2048 || x1) || +(b3));
+    {
+      {
+        const int v3 = (0 || (b3 + y3)), x1 = (b3 || (b1 - v3));
+        {
+          const int y3 = b1, a3 = (8 / 8);
+          return 0;
+          (7 != (b3 * y0));
+        }
+      }
+    }
+  }
+}
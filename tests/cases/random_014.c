@@ -0,0 +1,5 @@
+int main() {
+  ((12345 * 2048) <= (2047 != 2047));
+  014;
+  return (12 != (!(!(03777)) - 65536));
+}
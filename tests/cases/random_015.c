@@ -0,0 +1,5 @@
+int main() {
+  const int a1 = ((012 && 12345) - (8 <= 100)), v3 = ((a1 && 12345) + (0 * a1)), c3 = 3;
+  const int y2 = ((v3 * c3) < (2 != 12)), a3 = (c3 != 0 && (y2 == 014) / c3), x3 = a1;
+  return ((((2147483647 && x3) || (0x1000 - c3)) || ((x3 > x3) - (v3 - a3))) < (y2 == 0 || ((y2 && 12345) < (10 - 12345)) / y2));
+}
@@ -0,0 +1,24 @@
+int main() {
+  int x0 = (16 <= (10 == (12345 + 16)));
+  {
+    int c3 = (((x0 && x0) * (0 < 0)) == (!(x0) - (x0 && 2048)));
+    x0 = +(((1 / 5) || (x0 + 3)));
+    int a3 = (4096 - (!(x0) / (x0 || 4096))), x1 = (((16 / a3) + (a3 && a3)) + !((1 * x0)));
+    ;
+    x1 = c3;
+    ;
+  }
+  (0 > 10);
+  {
+    {
+      {
+        ;
+        x0 = ((x0 < (x0 / 3)) % (0x3039 + x0));
+        {
+          const int a3 = ((2047 - 03777) || 2048), a1 = ((a3 || a3) || a3);
+          return (7 - ((0 + 2147483647) == a1));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,26 @@
+int main() {
+  int c1 = (((1 && 014) || (5 || 16)) + (-(0) >= (16 > 0x10000))), y1 = (5 || (c1 == 0 || (c1 != c1) / c1));
+  +((y1 <= y1));
+  const int y3 = ((8 - 100) + (0x1000 && 100)), b1 = ((y3 * y3) > (y3 && y3));
+  int x2 = ((c1 == 0 || (3 > 0) / c1) && ((01 + y3) + (c1 + y3)));
+  const int a2 = +((030071 * b1));
+  const int c0 = ((05 % b1) || (0x1000 == a2));
+  y1 = (((c1 && c1) <= (c1 || 2)) && ((y3 == 2147483647) % (y1 >= y3)));
+  {
+    c1 = ((c0 != 0 && !(2048) / c0) > ((8 > 0x800) < (65536 && 02)));
+    {
+      int x3 = (((0x10000 + 0x10000) < (c0 >= b1)) != 12), v3 = (c1 != 0 && ((8 && a2) * (b1 * y1)) / c1);
+      {
+        const int a0 = (c0 - 0xc), y0 = ((0 == c0) <= a2), v3 = (c0 != 0 && 16 / c0);
+        {
+          int v2 = ((1 * (a0 >= c0)) > ((b1 != 8) <= (01 && c1)));
+          int x3 = (a2 + ((x2 != v3) < y3));
+          y1 = (((y3 >= 12345) || (v2 && 0x10000)) + x2);
+          const int c3 = ((8 < y3) - (v3 != y0)), y0 = ((c3 || 0) - (5 || a2));
+          return 100;
+          ((a0 + x2) == (2147483647 - a2));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,6 @@
+int main() {
+  const int c1 = 65536, b3 = ((c1 != 012) > (c1 && c1));
+  int x1 = (((c1 && b3) == c1) && ((b3 || c1) >= (c1 * 2048))), y0;
+  const int a3 = ((03777 || b3) || (010000 || b3));
+  return 12;
+}
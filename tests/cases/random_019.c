@@ -0,0 +1,18 @@
+int main() {
+  const int a1 = ((12 / 12) == (8 + 010)), x3 = +(!(a1)), x2 = ((3 <= a1) < x3);
+  const int x0 = ((0xa < x3) * 12);
+  int a0 = (((x0 != 0 && 0x2 / x0) - (x0 / 2)) / ((x2 - 8) || (x2 != 0 && 0x8 / x2))), x1, y2 = (((012 * a1) == (2048 >= x3)) == ((a1 - 2) / (x2 && x3)));
+  a0 = 3;
+  a0 = (y2 == 0 || a0 / y2);
+  {
+    int c0 = -(((x2 <= a0) <= (x0 == x3)));
+    ((x0 - x3) >= (4096 / 012));
+    int x0 = (((a0 && a1) * a1) + ((a1 <= x2) * c0)), a3 = 65536, c2;
+    const int a0 = ((x2 - 0x8) != 2048), b3 = (a0 == 0 || (a0 < a1) / a0), b2 = 2147483647;
+    x1 = c0;
+  }
+  int c1 = ((x2 != 0 && (x1 + 2) / x2) + ((12345 >= a0) - (04000 || 2048)));
+  int v0;
+  ((x0 <= x0) || a1);
+  return ((((x1 * 05) + a0) * ((c1 && 2147483647) < (a1 * x0))) && (((x0 != 0) >= (100 > 0x10)) || ((3 < 12) && (x2 >= x1))));
+}
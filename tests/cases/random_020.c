@@ -0,0 +1,12 @@
+int main() {
+  ((100 / 0x7) >= +(100));
+  int v2 = 2147483647, x3 = (v2 != 0 && v2 / v2), c1 = ((16 <= (12 - v2)) <= ((v2 + 1) / (x3 * x3)));
+  ((v2 - c1) - c1);
+  const int c0 = (+(2147483647) && (014 + 3)), b1 = c0, b0 = (c0 != 0 && (16 / 5) / c0);
+  int c2 = (v2 / ((c1 + 0x3) || (2048 > c1))), c3 = (((c2 - x3) || (b1 != x3)) || (x3 && (c1 + x3)));
+  const int y3 = ((b0 == 16) || (c0 >= b0)), b3 = 100;
+  ((017777777777 >= y3) || (05 * 2));
+  int b2 = -((y3 && +(16))), x1 = (((b1 || 3) > (8 > 0x10000)) * ((b0 == 5) < (c1 % y3)));
+  v2 = (((7 - 3) - (b1 == 0x3)) * ((c3 < v2) + (b1 && 2048)));
+  return -(c1);
+}
@@ -0,0 +1,4 @@
+int main() {
+  int x1 = -(((1 <= 4096) % 100));
+  return (02 && ((x1 % x1) || x1));
+}
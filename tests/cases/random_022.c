@@ -0,0 +1,6 @@
+int main() {
+  int x1 = (((4096 || 1) != 12) * 3), v0 = ((7 && (2147483647 + 2048)) || ((x1 != 0 && 2147483647 / x1) && -(x1))), y1 = 0x7;
+  x1 = (((12 / x1) * -(2048)) + (y1 < v0));
+  4096;
+  return (y1 != 0 && (x1 * ((100 && 1) != (0 != v0))) / y1);
+}
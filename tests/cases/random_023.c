@@ -0,0 +1,5 @@
+int main() {
+  const int c3 = (!(12345) > 65536), y3 = (c3 != 0 && (2047 > 16) / c3), a3 = y3;
+  100;
+  return a3;
+}
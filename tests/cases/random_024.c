@@ -0,0 +1,19 @@
+int main() {
+  int b1 = 5;
+  int x3;
+  const int b3 = ((7 >= 0x10) == (8 - 2)), x2 = (b3 > (5 > b3));
+  b1 = b3;
+  ((b1 != 4096) == (b3 - 12345));
+  {
+    const int v3 = ((x2 <= x2) && !(0)), y0 = ((2047 || 2048) || (5 < 8));
+  }
+  const int a0 = 0x10000;
+  {
+    {
+      const int a3 = 16, b1 = ((a3 > a3) <= (7 - 0xa)), c2 = ((16 == a3) <= (2147483647 && x2));
+      x3 = (!(16) + !((b1 > 2147483647)));
+    }
+    x3 = x2;
+  }
+  return ((-((0200000 * x3)) + ((7 != 10) / (b3 + 2048))) == (((5 + a0) <= (100 - b3)) > ((b3 < x3) * (16 + 8))));
+}
@@ -0,0 +1,17 @@
+int main() {
+  {
+    int v3 = (+((2147483647 > 100)) == 2047), y0;
+  }
+  {
+    const int c3 = (2048 - (0x7 - 10)), y3 = ((c3 * 2048) && (c3 <= 05)), b1 = ((y3 && y3) <= (y3 + c3));
+    {
+      {
+        {
+          int c0 = (((y3 != 5) - 2) - (0 < 0xc)), a0 = (((b1 && y3) < (c0 - c3)) && (+(5) % (y3 == 0 || 100 / y3)));
+          return !((c0 != 0 && 2 / c0));
+          ((b1 < c3) >= (a0 && c3));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,64 @@
+int main() {
+  ((0 + 16) || (12345 + 100));
+  {
+    014;
+    (02 % (4096 - 2));
+    int a3 = +(((2047 + 2048) % (017777777777 + 0x10000))), b0 = (a3 != 0 && a3 / a3);
+    {
+      {
+        b0 = ((a3 == 0 || (b0 == b0) / a3) || ((a3 != 0 && b0 / a3) % (0xa > 03)));
+        int b1 = (a3 || a3);
+        b1 = ((b1 + (12 >= b1)) - ((020 - a3) >= (0 + a3)));
+        a3 = (a3 && (2 * -(b1)));
+        {
+          int c0 = a3, y1 = 10, a1 = (((b1 % a3) / (5 - 2047)) + ((4096 + 0) && (b0 && y1)));
+          c0 = (((c0 || a3) * (c0 == a3)) + (y1 <= c0));
+          b1;
+          ((a1 * 12) + (1 && y1));
+          int b1 = (((b0 * y1) > (1 || 1)) * ((c0 * 2) || c0)), a2 = (((65536 == 3) != (2048 * 0x1000)) == ((b1 == 7) && b1));
+          ((a1 - 10) + a3);
+          (c0 && (12 / y1));
+        }
+        b1 = b1;
+        ((5 % b1) + (100 * 2048));
+      }
+    }
+    int b2;
+    {
+      ;
+      a3 = (+((a3 > 3)) && (a3 == 0 || (a3 * 100) / a3));
+      int a3 = ((b0 >= (b0 + b0)) != ((2047 || b0) || (b0 + b0))), c2 = (((0x64 || b0) >= (b0 && b0)) >= (a3 + (2048 || b0)));
+      {
+        const int x3 = ((2048 <= 2047) > (12345 == 0));
+        int y3 = (x3 != 0 && ((4096 - 7) * (0x7ff || c2)) / x3);
+        ((5 || a3) % (0x3 - 04000));
+        +((16 && 2));
+        const int b2 = ((x3 != 0 && 0200000 / x3) && (16 && x3));
+        const int b0 = ((x3 == 0 || b2 / x3) || x3);
+      }
+      (a3 != 0 && (a3 + c2) / a3);
+      a3 = (c2 == 0 || ((7 * a3) < (65536 || 2147483647)) / c2);
+      ((2147483647 && 0xc) || (0 && 16));
+    }
+  }
+  {
+    int x0 = (100 * ((07 + 5) * (4096 * 16))), v1 = ((x0 == 0 || (x0 - x0) / x0) && ((x0 >= 5) != (x0 % 4096)));
+    x0 = (((x0 * 2) / (x0 || v1)) - ((x0 - 12345) && v1));
+    {
+      v1 = !((1 && (x0 + 8)));
+      {
+        v1 = !((3 <= 4096));
+      }
+      const int c3 = ((0 < 0) * (0x7 >= 16)), c1 = 8, y3 = (2147483647 > (c3 - 0x7));
+      int x2 = (((c3 != 0 && 0 / c3) == (x0 && 01)) >= ((c1 + v1) && (65536 || y3)));
+      int y1 = ((v1 != 0 && (8 % 0x1000) / v1) <= y3);
+    }
+    const int a1 = ((65536 >= 2047) > (12 >= 0x3)), b3 = a1;
+    ((v1 == b3) / (b3 >= a1));
+  }
+  const int y1 = ((100 + 0x1) == (030071 <= 0)), y2 = (12 * (10 && y1)), v2 = ((10 != 12) == (y1 - y1));
+  {
+    return (((0 <= v2) + (y1 != 0 && y1 / y1)) || ((10 - v2) <= (65536 && y1)));
+    (y1 > (2048 >= y1));
+  }
+}
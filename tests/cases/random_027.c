@@ -0,0 +1,20 @@
+int main() {
+  int b0 = (((2 * 4096) <= (0 && 65536)) && ((2048 / 1) <= (12 % 01))), v0 = 0x1000;
+  {
+    v0 = v0;
+    b0 = (((b0 == v0) - +(8)) * (b0 / (v0 / v0)));
+    ;
+    int v0 = (((b0 < b0) * (b0 * 0)) != b0), x2 = ((2 <= (b0 != 0 && b0 / b0)) != (b0 + (10 - b0)));
+    x2 = ((x2 > (b0 || b0)) != ((65536 - x2) - (100 * 2048)));
+    ((x2 * x2) && (v0 <= x2));
+    int x3 = (+((x2 / 05)) + ((100 * 8) - (b0 && x2)));
+  }
+  v0 = (((65536 % 2048) + b0) < (b0 * (b0 == 0 || v0 / b0)));
+  const int x0 = ((100 != 0) + 0x3039), b3 = 4096, a2 = 05;
+  ;
+  b0 = ((12 || (b3 && a2)) - ((3 % b3) / (v0 || 2)));
+  ((65536 || 0) - (b3 < 12345));
+  ((65536 - 4096) || 2048);
+  ;
+  return 12;
+}
@@ -0,0 +1,4 @@
+int main() {
+  ;
+  return ((((0xa + 4096) % (7 % 2147483647)) % ((0 > 16) <= (3 >= 7))) - 4096);
+}
@@ -0,0 +1,40 @@
+int main() {
+  const int y2 = 2047, a0 = y2, c0 = ((10 - y2) || (y2 >= 65536));
+  {
+    ((c0 % y2) / (c0 + 100));
+    {
+      ;
+      int a0 = (1 + ((2147483647 - c0) + !(c0))), a1 = (((12 + 1) || (c0 < y2)) || ((c0 % c0) + +(1)));
+      int x1;
+      a1 = a1;
+      const int v3 = (c0 != 0 && (7 > c0) / c0), c0 = y2;
+      int c2 = ((+(10) * 2047) < !(100));
+      ((7 % c0) / (2048 > v3));
+      {
+        {
+          c2 = (((a0 <= c0) <= (y2 != 0 && 4096 / y2)) || ((c2 * 3) != (100 || a0)));
+          const int a0 = (c0 + (v3 != c0));
+          ;
+          2;
+        }
+        ((c2 % c0) || (c0 <= v3));
+        int a3;
+        a3 = c2;
+      }
+      const int a2 = ((c0 + v3) > (c0 == 0 || v3 / c0));
+    }
+    const int a2 = (8 + (c0 <= a0));
+    {
+      const int c2 = ((a2 <= y2) && (c0 - c0));
+      {
+        int b0, v1 = (0xa + ((1 < c0) <= c0)), x3 = (((16 >= 2147483647) * c0) - ((c0 == 0 || a2 / c0) - (c2 <= c0)));
+        const int b1 = ((a0 != 0 && 8 / a0) % (y2 + c0));
+      }
+      const int x0 = a0, c3 = (-(7) && (8 && 03777));
+    }
+  }
+  const int a1 = ((100 <= y2) || (0 >= a0)), c2 = 4096, x1 = c0;
+  const int c1 = ((c0 - 0144) && (0 - 0)), x0 = ((c2 >= x1) - c0);
+  int b2 = (((x0 == 0 || a1 / x0) - (c2 == 0 || y2 / c2)) >= 020), a3 = x0;
+  return ((((c1 >= c0) != (x1 * c2)) + ((a1 == 1) + +(x0))) != (0x7 && ((y2 && a3) != (c1 && c1))));
+}
@@ -0,0 +1,46 @@
+int main() {
+  {
+    const int b2 = 2048, a3 = b2, a0 = ((b2 && b2) && (a3 + 3));
+    const int c2 = (a0 != (a3 < a0));
+    const int x2 = ((7 < a3) >= (16 + c2)), c3 = ((a3 != a0) < (1 >= 5));
+    {
+      const int y0 = (c2 + 2), c2 = ((2047 - 07) != (y0 > x2));
+      const int v2 = 7;
+      {
+        int b1 = (((y0 > b2) <= (y0 == 3)) % ((v2 * 8) - x2)), a0 = (((y0 + 0x10) > (0x8 || 0x7fffffff)) * ((a3 == c3) / 4096));
+        b1 = (7 * ((7 && c2) != (a3 != 0 && b1 / a3)));
+        ((3 <= c2) % b1);
+        a0 = ((2047 != c2) >= ((2147483647 > v2) > (c3 || 0)));
+        const int x3 = ((y0 / a3) < !(x2)), a1 = +((y0 != 0 && 03777 / y0));
+        const int x2 = ((012 == 3) != (7 || a3));
+        b1 = v2;
+        int v3 = (((b2 == 0 || a3 / b2) + (y0 == 0 || b2 / y0)) / ((c3 + v2) != (1 * c2))), y0 = (((v3 * 3) <= (c2 - 2048)) != +((12 / v2)));
+      }
+    }
+    {
+      int a1 = (c3 == 0 || ((a3 * x2) * (x2 && c3)) / c3), y3;
+      y3 = (((a3 != 0x1) != (12 / 12)) > ((c3 < 100) < (b2 >= c3)));
+      ((b2 >= y3) + (a0 % b2));
+      int x0, a3 = 3;
+      a3 = (((3 < 8) * (0x2 <= 0x10)) + ((c2 - 1) && (c2 - a3)));
+      const int b1 = (2048 * a0), c0 = ((3 - x2) - a0);
+      a1 = ((0 % (c2 * b1)) == ((16 && b2) > (020 / a1)));
+      const int v3 = ((x2 && c0) || (c0 * a0));
+      y3 = (c0 + ((2047 || 65536) + (c3 || b2)));
+      a3 = (((a0 || 12345) % (b2 * a1)) != 10);
+    }
+  }
+  ((3 && 2147483647) != (12345 + 2));
+  int v1 = (2 == ((1 <= 100) - (2 / 100))), y1;
+  v1 = (v1 <= !(+(v1)));
+  {
+    {
+      (v1 || (v1 < v1));
+      {
+        int b0 = (v1 + (-(2047) >= (0xa - 7)));
+        return 2048;
+        b0;
+      }
+    }
+  }
+}
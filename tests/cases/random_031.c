@@ -0,0 +1,3 @@
+int main() {
+  return (3 - (((02 > 2048) || (8 <= 4096)) - ((0 || 2147483647) < (03777 + 10))));
+}
@@ -0,0 +1,4 @@
+int main() {
+  const int b3 = 01, y2 = ((b3 == 0 || b3 / b3) * (b3 > b3)), v1 = ((y2 - y2) - (b3 - b3));
+  return (-(b3) == +(v1));
+}
@@ -0,0 +1,19 @@
+int main() {
+  int c3 = (((12345 * 2) && (4096 - 12)) < ((8 == 2) / 100));
+  c3 = c3;
+  c3 = c3;
+  c3 = c3;
+  const int c2 = ((12345 && 16) || 2048), c0 = ((0x10000 < c2) || (c2 && 65536));
+  {
+    {
+      int v2 = (((c0 && 0) != c0) && c3);
+      int a0, a3;
+      const int x0 = (-(c0) % (c2 && c2));
+      v2 = v2;
+      v2 = c2;
+      int b2 = (((c2 != 0 && c3 / c2) >= 2048) || (c2 != 0 && (2048 < 0200000) / c2));
+    }
+    return (((12345 || 2047) == c3) == c2);
+    c3;
+  }
+}
@@ -0,0 +1,20 @@
+int main() {
+  const int a3 = ((0x5 && 2047) + (1 * 1));
+  ((a3 % a3) > (12 * a3));
+  {
+    {
+      {
+        const int b1 = a3, y0 = ((2047 || 0x3039) <= (a3 != 100));
+        12;
+        {
+          int c0, y3 = (((b1 % a3) && (0x3039 || 65536)) % b1), y2;
+          int x3 = (((y0 <= 0xc) || y3) == ((100 / 2047) || b1)), a0 = 2048;
+        }
+        {
+          return 0x800;
+          (2147483647 < (a3 > 04000));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,11 @@
+int main() {
+  int v2;
+  int y0 = (((3 + 2047) / (10 + 02)) >= 2), c0 = (((y0 - y0) * (y0 != y0)) % ((y0 <= y0) + 0x7));
+  ((c0 || 1) - (y0 >= c0));
+  int a2 = c0, v3, x0 = ((8 - c0) || ((1 && c0) >= (a2 * a2)));
+  const int x3 = 0xc;
+  ;
+  const int c2 = !((x3 && x3));
+  ;
+  return (x3 + (c0 == 0 || ((c2 && x0) || (c2 - c0)) / c0));
+}
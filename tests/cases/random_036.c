@@ -0,0 +1,5 @@
+int main() {
+  const int c0 = 7;
+  ;
+  return ((((c0 == 0x7) * (c0 * c0)) <= ((c0 && c0) >= (c0 < 4096))) && ((8 >= (7 % c0)) && ((c0 - 2048) || (c0 >= c0))));
+}
@@ -0,0 +1,12 @@
+int main() {
+  (2047 && (16 - 4096));
+  {
+  }
+  ((2147483647 - 2147483647) && 2147483647);
+  const int b0 = ((16 > 2147483647) + -(8)), b2 = (b0 != 0 && 12 / b0), v1 = (b0 == 0 || b0 / b0);
+  int y1 = ((+(b0) + (b2 > b0)) < ((8 - 0) * (b2 >= v1)));
+  y1 = (b2 == 0 || (v1 || (y1 - 7)) / b2);
+  y1 = ((b0 < (5 < 65536)) * b2);
+  const int v2 = ((v1 || b2) * (v1 * 10)), c0 = -((b2 || b2));
+  return (+(((v2 && 7) * 10)) && (((b0 - 017777777777) < (b2 % b2)) - (b0 == 0 || (012 / v1) / b0)));
+}
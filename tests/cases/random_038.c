@@ -0,0 +1,17 @@
+int main() {
+  {
+    const int x2 = 7, c2 = ((x2 || x2) == (x2 || x2)), c0 = (x2 * (c2 * c2));
+    x2;
+  }
+  int b3;
+  int a0, y2;
+  b3 = (!((5 + 2147483647)) - (100 >= +(12345)));
+  (b3 + !(2));
+  a0 = (((b3 || b3) * (10 + b3)) + +((b3 == 0 || b3 / b3)));
+  int c2 = ((2048 - (a0 + a0)) >= ((12 - a0) && (16 && a0))), a1 = (a0 / ((10 + b3) * 4096));
+  {
+    int a3 = c2, b0 = (((c2 && 0x2) >= (3 % a3)) < a0);
+    b0 = (100 + ((100 && 12) == (b3 <= a0)));
+  }
+  return (5 + ((c2 != 0 && b3 / c2) || ((c2 <= b3) < (c2 % 10))));
+}
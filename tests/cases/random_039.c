@@ -0,0 +1,6 @@
+int main() {
+  int b1 = (((0x7ff * 4096) + -(2147483647)) >= -((1 + 65536)));
+  ((0x7fffffff * b1) / 2048);
+  ;
+  return ((((b1 - 2) - (b1 + 2047)) != -((1 && 12))) - 1);
+}
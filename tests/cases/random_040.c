@@ -0,0 +1,7 @@
+int main() {
+  int v1 = (-((020 % 16)) / ((0x7fffffff + 8) < !(020))), b3 = (((v1 <= 04000) || (v1 + v1)) != (v1 > (v1 != v1))), a1 = (((v1 == 0 || 7 / v1) || (v1 + b3)) == (1 || (v1 - b3)));
+  int y0 = (((v1 + 65536) - (b3 || 0x10000)) != ((0 || a1) % (b3 / b3)));
+  const int v0 = (2 * 65536);
+  v1 = (y0 != 0 && ((65536 == a1) || (01 + v1)) / y0);
+  return ((y0 || (a1 + (v0 > 04000))) == (2047 >= 100));
+}
@@ -0,0 +1,8 @@
+int main() {
+  int x2 = (((0144 % 01) + (0x8 == 2047)) + 0);
+  (x2 != 0 && (x2 != 0 && x2 / x2) / x2);
+  ((x2 * 2048) * (0144 + 1));
+  ((4096 * x2) % (4096 - x2));
+  x2 = (((x2 > x2) == (x2 <= x2)) != ((x2 > x2) / (x2 + 2147483647)));
+  return (2047 * (((4096 >= 0xa) || (x2 * x2)) == (0 || (x2 * x2))));
+}
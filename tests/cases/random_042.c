@@ -0,0 +1,33 @@
+int main() {
+  const int c1 = (0x1000 || 10), a1 = ((7 + c1) + (c1 / c1)), y2 = (2 || (c1 && c1));
+  {
+    {
+    }
+    {
+      int v0 = 7, c1 = (((y2 != v0) || (12 <= v0)) <= (+(5) % (v0 * 2147483647)));
+      c1 = !((v0 != 12));
+    }
+  }
+  {
+    {
+      {
+        2147483647;
+        const int c1 = 0x2, x0 = (y2 % y2);
+        int v1 = ((+(a1) / (c1 == 0 || c1 / c1)) && x0), b1 = ((2047 > (y2 / 3)) <= x0), b2 = !(0);
+        {
+          b1 = (x0 - ((0200000 || c1) - (v1 != b2)));
+          v1 = +(b2);
+          int y1 = b1;
+        }
+        b2 = (((v1 * 0x3) == (10 && b2)) != (16 && 014));
+      }
+      const int b2 = ((a1 >= 0x1) != (c1 + 014)), x3 = !((a1 && c1)), c2 = ((2047 <= 4096) - (7 <= y2));
+      {
+        {
+          return (((c2 % 7) != (a1 + x3)) == ((7 * c2) - (10 <= c1)));
+          ((2048 > c2) * (012 / 2147483647));
+        }
+      }
+    }
+  }
+}
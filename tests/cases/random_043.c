@@ -0,0 +1,4 @@
+int main() {
+  int x2 = (((04000 + 3) && !(0200000)) * ((01 - 1) >= (3 && 0x1)));
+  return (x2 != ((x2 - 2048) != ((x2 == 0 || 8 / x2) != (x2 <= 2048))));
+}
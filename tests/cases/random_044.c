@@ -0,0 +1,27 @@
+int main() {
+  ;
+  const int b2 = 3, a1 = ((100 || b2) == +(b2));
+  const int c0 = -((0x1 >= 4096)), v2 = ((c0 <= 2047) - (b2 >= 16)), c1 = (a1 >= (1 > 12));
+  {
+    int a2 = (a1 - -((c1 - 12))), y2 = (((c1 % b2) % (b2 * v2)) * ((a1 && a1) || (c0 != 0 && a2 / c0)));
+    const int y0 = c1;
+    y2 = (((v2 == b2) != a1) < ((2047 >= c0) < (7 < y0)));
+    y2 = (((v2 > c0) / (b2 + 0x1000)) * (100 + (b2 - b2)));
+    int b2, b0 = (((a1 && 0x1) - (0200000 != c1)) * ((c1 == 0 || y2 / c1) || 10));
+    b2 = (b0 != 0 && ((5 / a2) > (y0 || 0)) / b0);
+    ;
+    a2 = v2;
+    {
+      b0 = (((y0 - 3) || (b0 == 0x3039)) || c1);
+      int b2 = y0, x1 = ((16 != (a2 && b2)) > ((y2 != 0 && y0 / y2) || (c0 != 0 && y2 / c0))), c0 = (b0 >= ((v2 != 0 && y0 / v2) > (c1 + b0)));
+      b0 = (((b2 == v2) % (0x1000 + 7)) && (01 == 01));
+      const int a3 = (v2 != 0 && (v2 != 0 && a1 / v2) / v2), c3 = ((a1 * c1) > (0x10 - c1)), y1 = ((0 || a3) >= (c3 - y0));
+      {
+        (c3 != 0 && a2 / c3);
+        {
+          return (((b2 <= 0x7ff) - (y2 + x1)) < ((2048 - y1) && (4096 <= 7)));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,5 @@
+int main() {
+  int c0 = 16;
+  const int v1 = (010000 + 01), c2 = ((v1 == 0 || v1 / v1) / (12 || v1));
+  return (((c0 || !(0)) + ((1 + 0) == (c0 >= c0))) + (((c2 * c0) + +(0x7)) <= ((v1 >= 7) - !(4096))));
+}
@@ -0,0 +1,26 @@
+int main() {
+  const int x2 = ((0 / 65536) - 100), b1 = (x2 <= (x2 > x2)), c3 = ((8 <= x2) >= (0x2 || b1));
+  {
+    {
+      int y3, v2, y1 = (0x5 < ((0x1000 + x2) && 65536));
+      {
+        v2 = -(((16 * x2) + (x2 != y1)));
+        ((c3 == v2) + 2147483647);
+        y3 = ((+(c3) > (2 && 0x7ff)) == (v2 == 0 || (v2 > 16) / v2));
+        int a1 = y3, y3 = (c3 == ((y1 || 2048) && (7 - x2))), b1 = -(x2);
+        !((a1 > y1));
+      }
+      int a2 = (((16 >= v2) <= 65536) + ((x2 || b1) || (v2 < b1))), a0 = -(((2147483647 && y1) + (1 > x2))), x0 = (((2147483647 * y3) < a0) - (!(0x10) < (y3 >= y1)));
+      const int y0 = ((b1 / b1) == (c3 != 0 && 65536 / c3)), a3 = x2;
+      int b1;
+      v2 = !(((x2 > 4096) > (y1 + 8)));
+      {
+        const int y0 = (a3 > (x2 && a3)), c0 = ((a3 * x2) + (c3 == c3)), a0 = ((a3 || c3) + c0);
+        const int b0 = ((65536 || x2) == 5);
+        {
+          return (((0 - 65536) == (16 == 1)) * (3 || (0x5 != a3)));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,49 @@
+int main() {
+  int v2 = (3 + ((0 > 02) || (16 - 0x64))), b2 = 16, c3 = b2;
+  c3 = (((c3 || 0) + (v2 != 0 && c3 / v2)) < ((b2 - b2) * +(v2)));
+  {
+    v2;
+    c3 = 5;
+    const int y3 = ((010 * 12345) || (7 - 3)), x0 = ((y3 || 0x1) < (1 && y3));
+    int a3 = (!(!(y3)) * 100);
+    (+(0) || (c3 && b2));
+    int c2 = (((2047 == y3) != (0x2 <= 16)) || y3);
+    const int y0 = ((4096 * y3) && 5), c3 = y0;
+    ((0x10000 * 10) / (c3 || 0));
+    {
+      a3;
+      b2 = (b2 != 0 && (b2 + (y3 != 0 && 4096 / y3)) / b2);
+    }
+    const int y1 = ((8 || 2048) || c3), x2 = (y3 || (y3 + y0));
+    b2 = (((2047 || 1) == (8 && 5)) == ((5 || y3) && (y3 != 0 && c3 / y3)));
+  }
+  {
+    {
+      const int c1 = -((0xa / 12345)), v3 = ((c1 != 0 && c1 / c1) - (c1 < 65536)), x0 = 7;
+      v2 = (((7 * c3) && (b2 - x0)) + ((100 * b2) * (v3 || c1)));
+      {
+        c3;
+        int y2;
+        !(03);
+        int c2 = ((c3 <= (b2 && 2147483647)) - +((10 - v3))), b2 = (((10 % c3) == (2048 && 12)) > 16), a1;
+        c3 = 1;
+        {
+          v2 = v3;
+          y2 = 10;
+          ;
+          const int c0 = (c1 != 0 && (v3 == 0 || v3 / v3) / c1), v0 = ((c1 < c0) <= (65536 + 4096));
+        }
+        2047;
+      }
+      const int x2 = ((7 - 4096) && (8 != v3));
+    }
+    const int a1 = (2048 || (12 >= 0x10)), a3 = ((a1 >= a1) || (a1 - 12)), b3 = ((a1 - a1) && (a3 >= a1));
+    int y1 = (b2 != 0 && ((c3 != 0 && 3 / c3) != 2) / b2), y3 = (((2047 * 0) || (c3 / a1)) * ((b3 + b3) <= (a3 * b3))), b1 = 0;
+    int c0 = (-(y1) - ((b3 > y1) * (010 - 16))), x0 = (((c3 * 16) * (3 % 12)) > ((0x8 % 2047) * y3));
+    ;
+    int x3 = ((y3 == (03777 / 12345)) + ((b1 >= y3) || b2));
+    y3 = ((c3 + (b3 < c0)) > ((x0 % 7) * c3));
+    return (((0x5 % 1) * (y3 == 7)) + ((y3 && c3) - 65536));
+    (+(b3) + 0);
+  }
+}
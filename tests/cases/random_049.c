@@ -0,0 +1,5 @@
+int main() {
+  int c0 = (((2047 == 10) && 2048) - ((2 > 0144) - (65536 + 65536)));
+  int y0 = c0, a2 = 2;
+  return (c0 * y0);
+}
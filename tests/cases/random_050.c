@@ -0,0 +1,27 @@
+int main() {
+  {
+    (100 != (3 && 100));
+    const int y3 = ((0 + 12) * (12345 > 030071)), y1 = y3;
+    {
+      {
+        int a1 = (10 && ((y1 * y3) + 0)), c3 = y3, v0 = 0;
+        ;
+        const int y2 = ((y3 * y1) || (y3 && y3)), a2 = ((12 <= y3) >= (0200000 - y1));
+      }
+      ;
+      {
+        int b3;
+        b3 = (017777777777 < ((3 || y3) == (y1 <= y1)));
+        int y0 = 2048, a0 = (((y3 || 3) - (b3 + y0)) / ((y0 - b3) || (y0 && 0x3)));
+        ;
+        a0 = (((12345 == y1) + b3) + 2047);
+        a0 = (((2048 + b3) > (4096 + y3)) != (0200000 - (b3 > 2)));
+        {
+          y0 = (((y0 % a0) == (1 + 4096)) + (y1 == 0 || (b3 == y1) / y1));
+          return (((7 <= 2147483647) || +(a0)) - ((y3 == y1) || y3));
+          ((7 || b3) || (1 && 4096));
+        }
+      }
+    }
+  }
+}
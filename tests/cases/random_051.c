@@ -0,0 +1,25 @@
+int main() {
+  {
+    int y2;
+    y2 = (((0 / 1) >= (2047 == 8)) != 7);
+    {
+      {
+        const int x0 = ((7 * 12345) > (4096 + 1)), y0 = ((x0 + 4096) || (x0 * 1)), c3 = ((4096 || y0) == (7 + 2147483647));
+        int y3 = (y0 == 0 || 2048 / y0), x2 = (((x0 % 0xc) != (y2 - 0)) != ((0xc && y3) || (c3 == 0 || y2 / c3))), v0 = (((c3 && y2) * (y2 * y3)) < x0);
+        ((x2 * y3) - (y2 > v0));
+        v0 = (v0 + ((y2 == c3) < (2048 / 4096)));
+        v0 = c3;
+        int b2 = v0;
+        y2 = (y0 > x0);
+        {
+          b2 = 16;
+          v0;
+          (c3 == (3 / b2));
+          int v0;
+          return (((1 || x2) + (8 || b2)) <= ((x0 * x0) || (y0 <= 5)));
+          (65536 - (y0 == y2));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,76 @@
+int main() {
+  const int y3 = ((7 + 12345) - 2048), b0 = y3, x3 = ((y3 && y3) || (4096 + y3));
+  ((x3 * y3) < (x3 || 5));
+  {
+    {
+      int y3 = !((b0 != 0 && +(b0) / b0));
+      ;
+      y3 = y3;
+      int b1 = ((0xc % 8) > ((b0 || x3) && 16));
+      {
+        (b1 == 0 || (y3 && b0) / b1);
+        const int c0 = (b0 && (x3 - 0x1)), b1 = ((5 * c0) == b0), a1 = 4096;
+        int c1 = (-((010000 || 16)) - ((4096 || 2147483647) / (7 + 030071))), b3;
+        ((y3 != b1) >= (3 < 0));
+        const int x1 = ((3 > 5) > (2048 < b1)), v2 = ((0 || a1) - b1);
+        b3 = (((v2 != 02) != (x1 || x3)) + x1);
+        {
+          c1 = (((1 + 1) - (c1 > y3)) != +((3 || a1)));
+          int y2 = b3, c3 = ((b1 % x3) < ((b3 * x3) != (7 * 2))), c2 = 2048;
+        }
+        {
+          c1 = (b3 / ((a1 > b0) <= (c0 == b3)));
+          0x1000;
+          ((v2 && y3) + v2);
+          b3 = (((0 && x1) + +(2147483647)) * (c1 * (a1 == 0 || x1 / a1)));
+          ;
+        }
+        const int v0 = ((c0 > b0) + !(b1));
+        (2147483647 * (y3 * 2147483647));
+      }
+      {
+        b1 = (((x3 % b0) && (12345 && x3)) > (b0 != 0 && (x3 - 2047) / b0));
+        int y3 = ((+(b0) && (x3 - x3)) == ((b0 % b1) && (b1 != b0))), a2 = (((0x7 * b1) * (10 == 5)) || (020 / (b1 + b0))), a0 = !(a2);
+        int y1 = (a2 + ((b0 - 07) > b0)), c3 = (((y1 && 2048) >= (3 < 0)) - ((2047 || 0x1) || (0xc >= y3)));
+        {
+        }
+      }
+      const int a3 = ((2 > x3) + (x3 * 16)), b3 = ((16 + 0x10000) / 0x10), c2 = x3;
+    }
+    int b0 = y3;
+    ((x3 != x3) + (3 < 65536));
+    {
+      int v2 = (65536 + 01), c0 = (((b0 || b0) != (b0 <= b0)) - (-(b0) - v2));
+      {
+        int c0 = (((v2 * v2) / (8 - x3)) || (2048 || 2147483647));
+        v2 = (((2047 == v2) == (v2 * v2)) < ((0 % 5) && (v2 && 0)));
+        ((c0 - v2) * (0 % b0));
+        const int y3 = ((12 + 8) + (x3 / 4096)), c3 = ((y3 <= y3) || 100);
+        {
+          const int v0 = ((65536 && c3) + 2047);
+          v2 = (((0 * c3) + (c3 || v0)) * ((0x5 || 100) * (c0 / 2048)));
+          const int b2 = y3, x1 = c3;
+          b0 = 017777777777;
+          v2 = (2048 || (x1 == 0 || (c3 <= x1) / x1));
+          const int a0 = ((0x3039 / y3) && c3);
+          c0 = ((a0 > -(03)) || ((b0 / 10) + 7));
+        }
+        int a1 = (((16 + 12) > (y3 * 100)) < ((12345 + c0) + c3));
+        const int b1 = ((2147483647 / y3) > x3), x3 = ((b1 <= b1) < +(c3));
+        a1 = (((a1 - 4096) * (16 != 7)) * ((c3 || 100) && (c3 != 0 && x3 / c3)));
+        const int a0 = x3;
+      }
+      ;
+      c0 = ((b0 * (b0 || b0)) + ((y3 != 0 && 3 / y3) <= (2147483647 || v2)));
+      v2 = (y3 && ((2048 + x3) < (v2 != v2)));
+      {
+        {
+          int b0 = (+((v2 <= 5)) && c0);
+          ;
+          int y1, c0 = (((x3 / 03) - (x3 + y3)) * !(!(2047))), v3 = (((2047 && 2047) - (v2 == c0)) == -((4096 <= 2147483647)));
+          return v3;
+        }
+      }
+    }
+  }
+}
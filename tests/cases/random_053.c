@@ -0,0 +1,15 @@
+int main() {
+  {
+    ;
+  }
+  ;
+  ;
+  {
+  }
+  int c0 = (2047 <= (-(0x5) || (10 - 5)));
+  c0 = (!(65536) <= ((c0 < 8) - (c0 < c0)));
+  const int a2 = 2048, x1 = ((a2 > 12) * (0 / a2));
+  c0 = (((0x7ff || 2048) != (12345 + 2048)) * ((a2 + a2) - x1));
+  c0 = (((x1 == 12345) || x1) - ((x1 <= c0) && (a2 == c0)));
+  return (0 - (-((x1 >= 7)) > (a2 / (a2 - c0))));
+}
@@ -0,0 +1,4 @@
+int main() {
+  int x1 = (!(-(2147483647)) > ((12345 >= 1) / 0xc)), v0 = (((x1 - 10) > (2047 || 65536)) || ((12345 - x1) && (x1 && x1)));
+  return (+((014 % (x1 != 12))) == (7 - (+(2048) - v0)));
+}
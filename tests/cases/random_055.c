@@ -0,0 +1,4 @@
+int main() {
+  int c0 = (((1 || 1) || -(0xa)) * (8 + (4096 / 2047))), b3 = c0, x1 = 4096;
+  return ((12 >= -((x1 * b3))) || (((100 && x1) - x1) * ((8 >= 7) && (b3 - c0))));
+}
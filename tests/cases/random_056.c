@@ -0,0 +1,10 @@
+int main() {
+  const int y2 = (!(2) + (0x8 + 5)), a1 = 0x7ff, y0 = -((a1 && y2));
+  (y2 - (a1 % 7));
+  const int v2 = ((y2 || y0) - (5 < 0)), v3 = ((3 % a1) - -(a1)), v0 = ((020 <= 2) || v2);
+  int b3, b0 = (a1 == 0 || ((v0 && a1) / (4096 + 65536)) / a1);
+  b0 = (y0 * (v3 * (b0 != 2047)));
+  int b1 = (((b0 || a1) || (y0 % 010000)) || y0), a0 = (((2147483647 || 7) + (y0 + 0)) <= y0);
+  const int y3 = (16 && (v2 - 0x5)), c0 = (a1 == 0 || !(7) / a1);
+  return v2;
+}
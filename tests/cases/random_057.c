@@ -0,0 +1,3 @@
+int main() {
+  return ((((2048 && 3) + (12 || 5)) + 5) != (((2048 >= 4096) && (1 || 12345)) < 12345));
+}
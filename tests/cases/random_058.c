@@ -0,0 +1,22 @@
+int main() {
+  int v1 = (((0 / 65536) - (01 && 5)) == 16), y1 = (v1 - 3), v2 = (y1 || (+(y1) - (5 >= 02)));
+  v1 = (v2 == 0 || 0x10000 / v2);
+  {
+    v2 = (2 && v1);
+    -(8);
+    const int a2 = (2047 * (12345 || 0x1000)), a1 = ((1 || a2) / (a2 || 2048));
+    int c0 = 8, c1;
+    const int b2 = ((a1 >= 0x64) > (100 * 8));
+    y1 = 2147483647;
+    y1 = (((5 * 100) != (b2 + v1)) < -(v2));
+    ;
+    int y1 = (((b2 + 02) * (a2 == 0)) > ((c0 && 5) - (a1 < 12)));
+    const int x0 = (a1 != a2);
+  }
+  ;
+  const int b3 = ((0144 < 2047) || 04000), a0 = ((b3 + b3) * (03777 - 2048));
+  const int c0 = ((3 == b3) && (b3 / a0));
+  y1 = (((2048 * 16) || b3) || ((c0 <= a0) > (2048 + 8)));
+  int c3, c1 = (((c0 == 0 || 65536 / c0) + (a0 - b3)) > ((v2 != 0 && 4096 / v2) && (b3 != v2)));
+  return ((b3 == ((v2 >= 010000) - v2)) == ((-(y1) || (2147483647 / v1)) && (a0 && (v2 - c0))));
+}
@@ -0,0 +1,4 @@
+int main() {
+  const int x0 = 16, v0 = ((100 < x0) * 100), a1 = (!(3) * (12345 + v0));
+  return ((((x0 * 10) >= (x0 && x0)) || ((v0 != 0 && 2 / v0) || (100 == 0x10))) - (10 * a1));
+}
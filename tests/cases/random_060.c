@@ -0,0 +1,8 @@
+int main() {
+  int c1;
+  c1 = +((0 || (2147483647 % 1)));
+  const int b0 = (+(5) <= (3 > 65536)), a0 = b0;
+  const int v2 = ((a0 < 2) || (b0 - b0)), x0 = (a0 != 0 && (8 / v2) / a0);
+  c1 = (a0 != 0 && (65536 <= a0) / a0);
+  return ((b0 - (+(c1) > (10 / 10))) < ((a0 == (04000 + 1)) + (+(x0) == (b0 < 0x64))));
+}
@@ -0,0 +1,10 @@
+int main() {
+  int c2 = (12345 && 0);
+  ((c2 || 100) + (12 < c2));
+  const int x0 = -((12345 / 2)), a2 = (x0 == 0 || (x0 > x0) / x0);
+  ((2147483647 < c2) && (c2 < 10));
+  int x3 = 07, b2;
+  c2 = (((x3 + 2048) * (5 * 0200000)) % 0x1);
+  int x2;
+  return (x3 && (2 - (0x7fffffff && (a2 == a2))));
+}
@@ -0,0 +1,13 @@
+int main() {
+  int x2;
+  x2 = 12;
+  int a3 = 7;
+  ;
+  int y0 = (((a3 + x2) + (x2 + a3)) != ((a3 < a3) == (x2 && x2))), v3 = ((-(a3) % (100 * x2)) && ((y0 < a3) >= (x2 && a3)));
+  const int y1 = !((2147483647 * 2048)), y2 = 4096;
+  y0 = ((y2 && (03777 + y1)) + ((12 && a3) / (y0 == 0 || y2 / y0)));
+  const int c3 = ((y2 != 0 && y1 / y2) != (2047 / 0x800)), c0 = ((y1 || c3) - (y2 <= y1));
+  y0 = (0x8 <= ((65536 && 0) >= (c0 == 1)));
+  x2 = (y2 || ((y1 + y1) * +(c3)));
+  return (((a3 == 0 || !(y0) / a3) - (y2 != 0 && (y1 && c3) / y2)) && ((-(c0) || y0) && ((x2 != 0 && 10 / x2) || (5 >= c0))));
+}
@@ -0,0 +1,17 @@
+int main() {
+  int a3 = 8, v2, y0 = (((a3 < a3) + (a3 - 0x3)) != ((a3 - a3) + (2 || a3)));
+  {
+    int c1 = ((a3 + (a3 - 16)) == ((a3 <= 2048) / 65536));
+    int c2 = 4096;
+    int a2 = (((c1 + c1) - (3 * 1)) && (!(c1) + (0 * c2))), v1;
+    a2 = (((c1 - 2) - -(y0)) < ((c1 && a2) - (a3 && c2)));
+    {
+      ;
+      ((y0 <= 65536) && -(a2));
+      int a2 = ((a3 || 16) - ((c2 + 5) && a3)), b2 = a3;
+    }
+    c2 = (a2 != 0 && a2 / a2);
+    return (((c2 + a3) - 3) + ((12345 * 2147483647) + (c2 * a2)));
+    0;
+  }
+}
@@ -0,0 +1,10 @@
+int main() {
+  const int x0 = ((2 % 030071) > 2048), a0 = x0, b1 = a0;
+  int b3 = ((x0 == 0 || (8 - 0) / x0) * +((10 <= a0))), x3 = ((a0 / (0x10000 >= x0)) < 100), b0 = (((7 == x3) != (b1 - b3)) || ((0x10000 && x3) / 2147483647));
+  b3 = (((b1 - x0) - (x0 * x3)) + ((b0 && x3) - a0));
+  b0 = (b1 - ((b1 <= b0) || (017777777777 && x0)));
+  int a3 = ((!(x3) != (x3 % 0xc)) < a0), y3 = (((a0 == 0 || 10 / a0) % (2 - b3)) / ((b3 != 0 && a0 / b3) || (x0 || 10)));
+  const int c2 = a0;
+  int a2 = b1;
+  return ((c2 != 0 && ((03 * b3) || (0x1 - 3)) / c2) * (b1 != 0 && (c2 <= (a3 - b0)) / b1));
+}
@@ -0,0 +1,24 @@
+int main() {
+  int b3 = ((0x1000 >= (7 < 4096)) != ((8 && 0) != 16)), b1 = (((b3 + 16) * (65536 == b3)) || 1), c1 = ((2147483647 + 65536) <= ((0 <= b1) || (b1 || b3)));
+  c1 = ((0200000 - (2147483647 && 12)) > ((5 && 65536) / (c1 >= c1)));
+  {
+    const int a0 = (7 == (1 < 1)), c3 = ((a0 && a0) + (03 * a0)), a2 = ((0 == a0) + (a0 + c3));
+    c1 = -(a2);
+    b3 = ((b1 == (a0 + c1)) - c1);
+    const int v1 = a2, a1 = ((v1 - 1) <= (v1 * a2)), x1 = (a2 + (0x3039 > a0));
+    c1 = (((a2 % v1) || (c1 && b3)) > (b3 == (c3 == 4096)));
+    {
+      const int v3 = -(0), y1 = ((a1 != 0 && a1 / a1) - (0x3039 < a1));
+      c1 = v1;
+      b1 = (3 != (+(v3) < (v1 + 05)));
+      b3 = (((y1 / x1) <= (a0 * b1)) || (7 * (0x10000 * 07)));
+      const int v0 = (c3 >= v1), y3 = (v1 != 0 && c3 / v1);
+    }
+    10;
+    {
+      -(c1);
+    }
+    ;
+    return (x1 == 0 || ((a2 != 0 && v1 / a2) < (10 / x1)) / x1);
+  }
+}
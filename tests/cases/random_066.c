@@ -0,0 +1,4 @@
+int main() {
+  int x2 = (017777777777 * -((0x7fffffff - 3)));
+  return (((-(2047) == (x2 || x2)) > x2) > (((x2 > 0) && (x2 - 100)) != ((x2 == 0 || x2 / x2) && (x2 / x2))));
+}
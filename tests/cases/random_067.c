@@ -0,0 +1,4 @@
+int main() {
+  const int x3 = ((1 > 0x10) * (65536 / 2048)), y0 = ((x3 && 10) < (7 - 0));
+  return ((12 - ((y0 == 0 || x3 / y0) > 2048)) + (x3 != 0 && ((y0 == 0x7ff) <= x3) / x3));
+}
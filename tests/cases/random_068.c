@@ -0,0 +1,46 @@
+int main() {
+  ((12345 != 03777) <= (1 / 0200000));
+  int y1 = 2147483647;
+  y1 = (((y1 / y1) % y1) || ((y1 - y1) >= !(y1)));
+  {
+    {
+      int x3, y3 = (((y1 >= 65536) - (y1 * 0x7ff)) + y1);
+      {
+        ;
+        ((10 != y3) < (y1 && 12));
+      }
+      y1 = 12;
+      {
+        y1 = ((0200000 * (y1 / y3)) == y1);
+        int c3 = 16, b3 = (((c3 >= 1) * 012) + ((2048 && y3) - (1 * c3)));
+        (7 * (y3 || y3));
+        ((10 > y3) - (0 || 0x7));
+        65536;
+        {
+          int y1 = ((-(y3) || (c3 == y3)) * ((y3 - 3) < (65536 || 2147483647))), x0, a0;
+          const int x2 = 0;
+          a0 = c3;
+          const int a1 = (x2 != 0 && !(x2) / x2), b2 = 030071;
+          c3 = (((a0 != 010000) % (65536 || y3)) - a0);
+          c3 = (65536 <= b3);
+          int c2 = (((a1 < 2047) + (a1 + y1)) <= (-(a0) * (b2 * y3)));
+          const int x3 = ((3 == a1) / -(0x2));
+        }
+        int y3, v3 = ((b3 != 0 && (b3 / 8) / b3) + y1), x2 = 0xc;
+        x3 = (+((0 - 16)) || ((v3 >= 12345) || v3));
+        (x2 == 0 || (2047 || b3) / x2);
+        ((v3 != 0 && 100 / v3) + (x2 + 4096));
+        ((v3 || 0) <= (v3 + v3));
+      }
+      y1 = +((8 < x3));
+      x3 = y1;
+      {
+        {
+          ((0x7ff || 10) * (y1 < 2048));
+          return (7 * ((0 >= y1) > (y1 / 2147483647)));
+          ((5 >= 65536) + (y1 == y1));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,12 @@
+int main() {
+  const int a2 = ((2147483647 - 030071) || -(05));
+  int v1 = ((+(a2) && (2 * 2147483647)) * ((a2 >= 0200000) == (a2 || a2))), c0 = (010000 || (2048 > (v1 - a2))), x3 = 0x64;
+  v1 = (!((65536 % 0144)) * ((c0 < a2) * (v1 > a2)));
+  x3 = (((c0 + 0x3) - 16) / x3);
+  const int c1 = (a2 == (a2 == 3)), x1 = c1;
+  ;
+  ((x1 - a2) == (x1 >= c1));
+  const int x2 = 12;
+  int a1 = !(((0x64 + 4096) < (3 < 2))), c2 = (v1 + ((2048 <= 2048) && (12345 && a1)));
+  return ((+(c2) + (0xa + x1)) * 2147483647);
+}
@@ -0,0 +1,5 @@
+int main() {
+  int x1 = 8, x3 = -(((020 - 2047) * x1));
+  ;
+  return ((x3 && ((0x1 * 12) * (4096 - x3))) + -(((x3 && 01) && x3)));
+}
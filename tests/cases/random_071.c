@@ -0,0 +1,18 @@
+int main() {
+  {
+    {
+      int y0 = (((0 && 8) % (3 - 0)) && 10);
+      {
+        int c2 = y0;
+        int x3 = (((c2 != 0 && y0 / c2) == (2047 - c2)) == c2);
+        ;
+        ((x3 / x3) + (4096 * c2));
+        x3 = +((8 <= (x3 + x3)));
+        {
+          return 0x7fffffff;
+          -((c2 >= 0));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,51 @@
+int main() {
+  {
+    int y2 = +(((65536 || 2048) - (12 * 0x10000))), c2 = (((16 != y2) / 0200000) * (+(y2) + (y2 == 0 || 100 / y2))), v0 = -(((y2 - 8) != (16 * y2)));
+    const int a2 = ((10 * 030071) || (2147483647 || 16)), v1 = ((a2 != a2) * (a2 >= a2));
+    int x2, b1 = (0200000 || ((v0 || 2048) && (1 * c2)));
+    v0 = 10;
+    {
+      x2 = (+((v0 + 12345)) * ((b1 * b1) || (5 > 4096)));
+      int b0, c1 = (((y2 % b1) >= (030071 >= 4096)) == ((0x1000 || 0x10) || (2 - c2))), y2 = (1 || ((020 >= 10) <= (7 * v0)));
+      int a2 = (12345 > ((y2 || 0) >= (c1 != 0 && v1 / c1)));
+      (-(1) && (012 > 100));
+      int a3 = ((12 >= (10 - y2)) - (a2 == 0 || x2 / a2)), v3, x0 = (((c1 == x2) > (a2 || 03)) || ((0x10000 || c2) < (a3 && a2)));
+      int b3;
+      const int c0 = ((v1 == v1) % (2048 * 65536)), c3 = 012;
+      int y1, x2;
+      ;
+      ;
+      int c2 = (((v1 != 0 && a3 / v1) <= (10 * a2)) <= ((010000 - v1) * (x0 * 7)));
+    }
+    (v0 == (c2 % 12));
+    {
+      const int x1 = ((v1 / a2) || v1);
+      v0 = ((v0 > (x2 - c2)) - ((2048 * 16) + (12 + 2047)));
+      (c2 * (c2 && 2147483647));
+    }
+    {
+      {
+        int c1 = (((y2 / 2047) + (5 < 7)) > ((10 > a2) + (0xa && v1))), c3 = (((12345 && 4096) % x2) && !((y2 * v1)));
+        b1 = ((c2 == 0 || (c1 != 0 && c1 / c1) / c2) && ((8 || 2048) > (v0 >= v0)));
+        b1 = (!((y2 || v1)) - 1);
+        y2 = (((v1 > b1) + c2) - 12);
+        c3 = (((v0 >= x2) * (v1 && c3)) * (b1 - (a2 * 2147483647)));
+      }
+      ;
+      int x2 = (v1 < ((a2 * y2) != (a2 - v1))), y0 = (((c2 <= y2) > (v0 && 0xa)) < ((5 || b1) - (b1 && 0))), b2 = (c2 || ((y0 + 7) <= (x2 || y0)));
+      ;
+      (+(16) + (a2 % 4096));
+      ((y2 || 2147483647) + (2147483647 || 12345));
+      ((020 && v1) && (v0 + c2));
+      const int x1 = +(v1);
+      {
+        int a0 = (((v0 == 65536) || (b1 != 0 && b2 / b1)) || -((4096 * 0x10000)));
+        int b2 = 2048, a2 = (b1 != 0 && c2 / b1), v3 = -(((a0 >= b2) == (x1 + v1)));
+        int v1 = (((x1 + v3) != (0 == v0)) && ((7 + 100) + (y2 && 1)));
+        a2 = (((b1 || 12) || (5 <= v3)) + b2);
+        const int y3 = (0 && 3), x2 = (x1 != 0 && (65536 != x1) / x1);
+        return (((x1 && v0) * x2) >= ((b2 != 0 && 2 / b2) > (v1 || 010)));
+      }
+    }
+  }
+}
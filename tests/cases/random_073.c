@@ -0,0 +1,16 @@
+int main() {
+  const int y1 = ((0x3 - 4096) * 2047), x3 = y1;
+  int a3 = (((y1 * x3) + (0x64 * x3)) || 5), v3 = ((y1 || a3) > ((y1 + 16) * -(2))), x2 = y1;
+  {
+    (!(v3) / (x2 % 8));
+    {
+      a3 = ((v3 == 0 || (y1 + x3) / v3) <= ((100 + a3) - (y1 == y1)));
+    }
+    const int y1 = ((2147483647 >= x3) || x3), b3 = (x3 + (2048 && y1));
+    x2 = (((b3 / a3) - x2) || (a3 == (2147483647 != b3)));
+    int c1 = (((x3 < 7) + (x3 * x3)) && (a3 * 2147483647));
+    x2 = (v3 || ((b3 || 65536) % 2));
+  }
+  int y3 = ((+(x2) || (x3 || 1)) + ((a3 && v3) + !(v3))), a2;
+  return ((y1 != 0 && ((v3 > 65536) * (y1 == 0 || y3 / y1)) / y1) + (x3 < 0));
+}
@@ -0,0 +1,10 @@
+int main() {
+  const int c1 = (12345 && (2147483647 >= 0x7fffffff));
+  int y3 = (7 + (c1 != (c1 || c1)));
+  y3 = ((0 * (y3 == 8)) - y3);
+  {
+    ((c1 % y3) + (c1 > 16));
+    return (y3 == c1);
+    (c1 > c1);
+  }
+}
@@ -0,0 +1,25 @@
+int main() {
+  ;
+  {
+    ((12 * 2047) / (12345 || 010));
+    {
+      {
+        int v0 = (-((16 - 8)) * ((12345 != 017777777777) + (0x3039 || 12))), c1 = (((v0 && v0) && (2047 != v0)) * ((v0 || v0) + 10)), x3 = (((c1 > v0) * (2047 || v0)) + ((v0 * c1) && (v0 != 0 && c1 / v0)));
+      }
+      const int c1 = ((7 != 017777777777) > 03777);
+      int b1;
+    }
+    const int x3 = ((12345 % 014) * (03 || 0x5)), a2 = x3;
+    {
+      int a1 = ((x3 - (x3 > x3)) + ((2147483647 % x3) <= x3)), a2 = a1, v2;
+      v2 = (a1 / ((1 && 3) > (a1 == 0 || x3 / a1)));
+      a1 = !((a1 + (65536 < 0x1)));
+      int x0 = ((x3 == 0 || (2147483647 > 020) / x3) || 0x3);
+      a1 = (((a2 >= 2048) + v2) >= ((v2 + 02) >= v2));
+      a1;
+      int b3 = (((a2 <= 0xa) && (v2 - a1)) * ((2047 && v2) - (0 != x0))), a3 = (((2048 <= 2047) % a2) <= +((v2 * b3)));
+      int v0 = ((x3 > (65536 && a1)) - !((x3 == a2)));
+      return ((0x1 % (v0 + 3)) < a1);
+    }
+  }
+}
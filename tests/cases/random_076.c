@@ -0,0 +1,15 @@
+int main() {
+  const int c2 = (16 <= !(4096));
+  ((c2 == 0 || c2 / c2) != !(c2));
+  {
+    const int b3 = ((c2 + c2) + (c2 && c2));
+    (c2 == 0 || (c2 != 0 && b3 / c2) / c2);
+    c2;
+    ;
+    const int v2 = ((0144 != 0x3) && (b3 || 1)), v0 = +((7 && v2)), x0 = ((v2 > 12345) * b3);
+    int y3 = (((v0 < 012) * !(v2)) && ((c2 < c2) >= (c2 * 2047))), c1 = (((5 && c2) == (c2 <= 16)) || ((2047 >= v2) >= (v2 == c2)));
+    const int a0 = !((b3 + v0)), x1 = ((v2 / 0x64) && (10 != 5));
+    (!(y3) || (a0 || 5));
+  }
+  return (((c2 && c2) || c2) || (((3 - 100) + 0144) != ((c2 / 7) < (1 >= 2147483647))));
+}
@@ -0,0 +1,8 @@
+int main() {
+  int b0 = (0x7fffffff <= (8 * (0x3 != 12)));
+  int a0;
+  (8 || -(3));
+  ((b0 == 0 || 2147483647 / b0) && (b0 || b0));
+  ;
+  return ((b0 * b0) >= (-(0) + (b0 - 10)));
+}
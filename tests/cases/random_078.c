@@ -0,0 +1,9 @@
+int main() {
+  const int v2 = ((65536 > 0) % (100 + 4096)), b1 = ((v2 / v2) && (2048 && 2)), y0 = 10;
+  const int a2 = (y0 == v2);
+  const int x3 = +((0x5 || 4096));
+  {
+    const int a2 = ((0200000 <= v2) != (y0 + 10)), x0 = ((y0 * b1) == (a2 && b1)), v0 = ((y0 > 2) != (65536 + x0));
+  }
+  return ((((a2 < 12345) != (v2 && x3)) + (0x10 > (b1 || 2047))) + (((v2 <= y0) % 8) - ((2 || b1) && (100 - x3))));
+}
@@ -0,0 +1,4 @@
+int main() {
+  int v3 = (((04000 * 0x10000) * (2 - 0x3039)) * 7), c1, c3 = v3;
+  return ((((2147483647 && 0x7ff) && (v3 + v3)) != ((v3 || v3) <= (v3 % c3))) > ((12 <= c3) % v3));
+}
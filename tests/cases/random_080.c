@@ -0,0 +1,10 @@
+int main() {
+  {
+    {
+      const int b0 = 5;
+      int y1 = ((b0 + (b0 == 0 || 10 / b0)) * (b0 != 0 && (0 && b0) / b0)), a0 = (((y1 >= 7) * (3 < b0)) <= (03 * (12 - 2)));
+      return (((0x2 + y1) - (16 % a0)) + ((07 - a0) % (a0 || a0)));
+      65536;
+    }
+  }
+}
@@ -0,0 +1,51 @@
+int main() {
+  {
+    {
+      const int y0 = ((8 * 16) && (7 != 10)), x1 = (y0 == 0 || (y0 >= y0) / y0), c1 = (!(2048) / y0);
+      const int a2 = (y0 != 0 && (c1 == 4096) / y0);
+    }
+    ((65536 + 2048) > (12 || 5));
+    ;
+  }
+  int b2 = (((2047 == 8) * (017777777777 && 2048)) < +(5));
+  int y3 = ((65536 * b2) + (12345 <= (10 || 014))), a2 = (((b2 >= y3) && (y3 != 0 && y3 / y3)) <= (y3 != 0 && (017777777777 * b2) / y3));
+  int v2 = ((b2 == 0 || (a2 == 0 || a2 / a2) / b2) || (y3 != 0 && (a2 || 2048) / y3)), v0 = (((a2 != 0 && 1 / a2) - (y3 == 0 || 8 / y3)) >= (v2 == 0 || (4096 + b2) / v2));
+  {
+    int y2 = a2;
+    y2 = (y2 == 0 || ((a2 + 01) > +(0)) / y2);
+    v0 = ((y2 != 0 && (12 >= 3) / y2) > 0x800);
+    int a2;
+    int y1 = (((v0 != b2) || (v2 == v0)) >= ((v0 + y2) <= (2048 + v2)));
+    ;
+    int v1 = (y2 != 0 && ((1 + 16) || (y2 && 1)) / y2), b2 = (((v2 == 0 || y3 / v2) - 2048) && (y2 + (12 && v1)));
+  }
+  y3 = (b2 != 0 && (y3 + (y3 % 12)) / b2);
+  const int y1 = ((65536 || 7) || 0x64);
+  {
+    int c1 = (y1 && ((y1 + y3) || (0 < 2047)));
+    int c3 = (((b2 == 1) && (c1 - a2)) < (c1 * 65536));
+    {
+      {
+        a2 = (((030071 * v0) && (y3 || v2)) % (!(c1) <= (a2 * 65536)));
+        c1 = (b2 == 0 || ((b2 / c1) < (16 || c1)) / b2);
+        b2 = ((v0 / (12345 > c1)) * ((a2 == 2048) != (y3 != v2)));
+        {
+          b2 = ((100 / (y3 == c3)) % ((v2 || c3) / c3));
+          int a2 = ((c3 > v2) && ((03 > y3) - (c1 / y3))), b2 = (((2147483647 - 2147483647) + (3 + 100)) && c1);
+          const int b3 = ((y1 - y1) > (100 - 10)), v1 = ((b3 * b3) || (2048 >= 100)), a0 = !((v1 * y1));
+          int y3 = (((0x7ff - c1) || (4096 < 0x5)) * (c3 || v1)), c0 = y1;
+        }
+      }
+    }
+    int b0 = y3, a3 = (+((04000 <= 2147483647)) == ((b2 > 0) * (b0 || 2047))), x0 = ((b0 && (65536 >= v0)) + (c3 <= (a2 > y1)));
+    c3 = 0x7ff;
+    int a1;
+    ((a3 && v0) + (b0 - 02));
+    const int y1 = (014 && (7 < 12345)), a2 = ((y1 || y1) + (1 % y1));
+    int y3;
+    const int c2 = ((y1 != 0 && y1 / y1) % (y1 && y1));
+    v0 = (((b2 != 0 && 10 / b2) * (v0 <= 8)) <= c2);
+    const int c0 = ((a2 - c2) || (c2 * y1));
+  }
+  return ((a2 * ((12 * a2) + (10 - 0))) / (((v0 != b2) && (2047 || b2)) && ((v2 != 8) <= (2147483647 || a2))));
+}
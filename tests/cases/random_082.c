@@ -0,0 +1,12 @@
+int main() {
+  {
+    int b2 = (05 / 100);
+    {
+      b2 = (b2 == ((b2 + 10) || (b2 != 0 && 100 / b2)));
+      (b2 == 0 || (12345 * b2) / b2);
+    }
+    b2 = -(((b2 && 0x2) && (b2 < b2)));
+    return (!(b2) == ((b2 == b2) < (b2 + b2)));
+    (b2 != 0 && (65536 - b2) / b2);
+  }
+}
@@ -0,0 +1,13 @@
+int main() {
+  {
+    const int a0 = ((010000 - 16) < (12345 <= 1)), a3 = ((a0 * a0) < (a0 && a0));
+    {
+      const int x3 = a3;
+      const int b0 = (12345 * (a3 < 10));
+      ((030071 / 0x7) && (a0 && a3));
+      const int c3 = 2, v0 = ((b0 >= a0) && (3 + c3));
+      return (((2047 != c3) + (2147483647 + 2047)) % ((a3 % 12) == a3));
+      2;
+    }
+  }
+}
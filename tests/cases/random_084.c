@@ -0,0 +1,13 @@
+int main() {
+  int x0 = (5 * ((020 && 65536) < (0x2 + 10)));
+  x0;
+  x0 = (-((x0 || x0)) && ((2147483647 != x0) || x0));
+  const int v3 = 65536, x2 = v3;
+  const int c3 = 0;
+  x0 = v3;
+  x0 = ((x2 != (x0 || x2)) + (x2 == (c3 || 100)));
+  int y3 = (!(x2) - x2);
+  x0 = (((x0 + 2047) == (0x800 != c3)) || !((v3 % 014)));
+  const int b2 = x2, x1 = (b2 != 0 && (v3 >= c3) / b2);
+  return ((((4096 && c3) * y3) + ((5 * c3) + +(5))) || ((v3 && (b2 != 0 && x1 / b2)) + c3));
+}
@@ -0,0 +1,12 @@
+int main() {
+  ;
+  {
+    int c1 = ((!(2) - (10 * 012)) <= +(5)), v1 = (c1 < ((c1 <= 5) || c1));
+    int v0 = (v1 % (2 >= (v1 && v1)));
+    ;
+    ((v0 <= 2147483647) + (v1 > v1));
+  }
+  const int y1 = ((0x2 + 7) + (0 + 2));
+  int a1;
+  return y1;
+}
@@ -0,0 +1,3 @@
+int main() {
+  return ((((0x3039 + 8) / 7) == ((2047 * 2048) * (12 || 2047))) * (((0x1000 - 3) * -(65536)) + (+(100) + -(7))));
+}
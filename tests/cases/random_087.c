@@ -0,0 +1,18 @@
+int main() {
+  ;
+  {
+    const int v2 = (2048 && (8 * 7)), a2 = v2;
+    int v3 = ((-(12) - (3 - 16)) * v2), y2 = (((v2 != a2) <= (a2 <= 5)) == ((0x5 > v2) != 0)), b2 = (((y2 < 2047) < (v3 % 65536)) - +(!(v2)));
+    ;
+    {
+      y2 = (v2 != 0 && a2 / v2);
+      (v3 == 0 || (b2 + a2) / v3);
+    }
+    ((7 + 10) == +(1));
+    {
+      int a1 = (((4096 && 3) || 12) <= ((0x7fffffff * v3) + 02)), c1 = (10 * ((b2 + v3) || (v3 && v3))), a2 = (((b2 % 2047) > (0x1 && a1)) <= ((y2 > b2) - (c1 != v3)));
+      int v1 = c1, y0 = ((v2 <= 0x7) && ((a2 || 8) || -(b2)));
+    }
+    return (12345 + ((0x7ff <= 014) && (a2 * b2)));
+  }
+}
@@ -0,0 +1,7 @@
+int main() {
+  int v0 = (3 - ((3 < 0x64) != (012 > 0)));
+  ((v0 && v0) + v0);
+  ;
+  !(v0);
+  return (v0 == 0 || (v0 || ((v0 == 0 || 10 / v0) != v0)) / v0);
+}
@@ -0,0 +1,17 @@
+int main() {
+  {
+    const int b3 = (7 != 5);
+    {
+    }
+    const int x0 = ((b3 != 0 && b3 / b3) != 7), c1 = ((b3 && 2147483647) * (2047 <= x0));
+    (c1 - (4096 || c1));
+    ((2147483647 - x0) <= (c1 != c1));
+    const int y0 = (x0 || (4096 + c1));
+    {
+      {
+        const int c2 = ((c1 + 2147483647) * y0);
+      }
+      return c1;
+    }
+  }
+}
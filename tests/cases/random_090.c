@@ -0,0 +1,5 @@
+int main() {
+  ;
+  int x2 = !(2048), a1 = (x2 != 0 && x2 / x2);
+  return +(0);
+}
@@ -0,0 +1,3 @@
+int main() {
+  return ((((8 * 8) > 2) - ((2048 && 010000) == 2047)) - (((0x8 || 4096) - (5 && 12345)) >= ((1 && 7) > (8 == 5))));
+}
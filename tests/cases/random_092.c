@@ -0,0 +1,22 @@
+int main() {
+  {
+    {
+      {
+      }
+      {
+        0;
+      }
+      7;
+      int x1 = (2047 - ((5 <= 0) < (0x7fffffff / 04000))), y2 = 65536;
+      int b2 = ((y2 != (2147483647 * x1)) * y2);
+      ((4096 > 2048) + b2);
+      b2;
+      {
+        {
+          int b1 = (((2048 < 1) > (b2 || b2)) - ((y2 > 8) == (y2 == y2)));
+          return (b2 == 0 || b1 / b2);
+        }
+      }
+    }
+  }
+}
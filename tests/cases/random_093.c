@@ -0,0 +1,11 @@
+int main() {
+  ;
+  const int b3 = 7;
+  ((8 * 0200000) && (65536 > b3));
+  {
+    const int a1 = (b3 || (b3 || 12)), c0 = (!(0x3039) + (b3 % b3));
+    const int b0 = (a1 * (a1 != b3));
+  }
+  int x0 = ((2 && (b3 == 0 || b3 / b3)) + 010000), y1, v1 = 7;
+  return (((x0 == 0 || (x0 == 0 || 0x3 / x0) / x0) * ((10 == b3) < 05)) - 02);
+}
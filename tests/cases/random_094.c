@@ -0,0 +1,21 @@
+int main() {
+  int c3, v3 = (+((2047 - 1)) >= (16 >= (4096 && 0x7ff)));
+  const int b0 = (7 >= (0x10000 > 8)), v0 = (5 == b0), v1 = b0;
+  c3 = (((12345 + v0) % (0144 - 2147483647)) && 05);
+  c3 = (v1 || c3);
+  {
+    c3;
+    int x2 = 65536, a0;
+    {
+      int c3 = ((12 + 7) * ((v0 % b0) || (v1 * 65536)));
+      v3 = ((3 < v1) % 0x10);
+      {
+        (!(v0) * (8 || v0));
+        {
+          int a3 = (b0 + 7), a1 = (((a3 && 0) && (c3 || v3)) + (b0 == 0 || (2048 * a3) / b0)), v3 = 2047;
+          return v3;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,8 @@
+int main() {
+  const int a1 = (!(2147483647) >= -(2048)), b1 = ((3 && 65536) < 2147483647);
+  int b3 = ((a1 != 0 && (7 * b1) / a1) * -((a1 != a1)));
+  b3 = b1;
+  ((b3 || b1) == (16 + b3));
+  b3 = ((b1 && (a1 * 0xa)) - (65536 - (b1 * a1)));
+  return b1;
+}
@@ -0,0 +1,9 @@
+int main() {
+  int x1 = +(0x64), c2 = (x1 == 0 || ((2147483647 && x1) != (x1 && x1)) / x1);
+  int x3 = 2047;
+  c2 = (((x3 == c2) != x1) > x3);
+  const int v0 = ((0x7 % 8) * (100 * 2));
+  c2 = ((65536 - v0) != !((2 + 4096)));
+  int a2 = (((0x3039 != x1) / 0x7) && (v0 + (x3 || c2))), b1 = ((+(4096) - (x1 && v0)) == (c2 > (x3 && a2)));
+  return ((((12345 && 16) * (5 * a2)) == (x1 + (65536 > 2047))) > ((x1 || (x1 > 03)) && ((b1 != 0 && x3 / b1) + (2048 / 0xc))));
+}
@@ -0,0 +1,5 @@
+int main() {
+  {
+  }
+  return !((((7 == 4096) / 3) * !(2)));
+}
@@ -0,0 +1,15 @@
+int main() {
+  const int a3 = (65536 || (0 && 0)), c2 = 0200000;
+  {
+    {
+      ((2147483647 / 7) > (a3 == 12345));
+      a3;
+      int v2 = (c2 != 0 && ((a3 >= 0) && (4096 / 0x1000)) / c2);
+    }
+  }
+  {
+  }
+  ;
+  ;
+  return ((((a3 - c2) + (c2 < c2)) * (a3 != c2)) - ((a3 / (a3 % 12345)) && ((a3 / c2) && (2 || a3))));
+}
@@ -0,0 +1,17 @@
+int main() {
+  int a2 = (((2048 && 010) + (2 != 2147483647)) * 100);
+  int x1 = !(((12345 < 2147483647) - a2));
+  (2048 * (12345 - a2));
+  x1 = (((a2 != x1) <= -(x1)) - x1);
+  {
+    const int x2 = ((8 - 8) < (7 > 12)), v1 = (x2 || x2);
+    x1 = (((a2 == 0 || 2 / a2) == (020 || v1)) + ((2048 - 7) - (v1 || v1)));
+    (-(a2) - (v1 + x1));
+    a2 = (x1 == 0 || (10 - x2) / x1);
+    const int y1 = (5 || v1);
+    int b1 = v1, b2 = y1, v0 = (((2047 < y1) * (a2 < 16)) <= ((100 != 2048) - (16 + b1)));
+    int x0 = (((1 < b2) + 1) / (b2 * 2)), v3 = (((x0 >= 2147483647) * +(b2)) > ((x1 != 0) <= (7 - 0xc)));
+    x1 = -(((x2 + 0x800) && (x1 <= x2)));
+  }
+  return (a2 == 0 || ((8 + -(020)) > 16) / a2);
+}
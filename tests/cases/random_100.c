@@ -0,0 +1,4 @@
+int main() {
+  int v2 = (((07 > 2047) > (12345 || 04000)) * ((010 < 0) + (5 || 1)));
+  return ((+((v2 >= 2147483647)) * ((v2 < 3) - (v2 == 2047))) != v2);
+}
@@ -0,0 +1,33 @@
+// 内层代码块中的同名变量遮盖外层的变量, 对外层变量的赋值在离开代码块后仍然有效
+int main() {
+  int x = 1;
+  const int k = 3;
+  {
+    int x = 10;
+    x = x + k;
+    {
+      const int k = 100;
+      x = x + k;
+      {
+        int x = k;
+        x = x * 2;
+      }
+    }
+  }
+  x = x * 7;
+  {
+    x = x + 2;
+    int x = 5;
+    x = x + 1;
+  }
+  int y = x;
+  {
+    int y = x * 10;
+    x = y;
+  }
+  {
+    const int x = k * 4;
+    y = y + x;
+  }
+  return y;
+}
@@ -0,0 +1,15 @@
+// && 和 || 保护的除法: 除数是 0 时右边不能求值
+int main() {
+  int zero = 0;
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int z = one - 1;
+  int a = z != 0 && 100 / z;
+  int b = z == 0 || 100 / z;
+  int c = one != 0 && 100 / one;
+  int d = (z && 1 / z) || (one && 9 / one > 8);
+  int e = !(zero || z) && (s / one == 7);
+  int f = (a || b) + (c && d) * 2 + e * 4;
+  int g = one && (z || (s / (one + 1) == 3 && s % (one + 1)));
+  return f * 100 + g * 10 + a + b;
+}
@@ -0,0 +1,89 @@
+// 40 个同时活跃的值, 超过可以分配的寄存器数, 一部分值要溢出到栈上
+int main() {
+  // 运行时才知道 one 的值: && 的右边有除法, 不能提前计算, 两条路径在基本块参数处汇合
+  int s = 7;
+  int one = s != 0 && 7 / s > 0;
+  int v0 = one * 1 + 0;
+  int v1 = one * 4 + 1;
+  int v2 = one * 7 + 2;
+  int v3 = one * 10 + 3;
+  int v4 = one * 13 + 4;
+  int v5 = one * 16 + 5;
+  int v6 = one * 19 + 6;
+  int v7 = one * 22 + 0;
+  int v8 = one * 25 + 1;
+  int v9 = one * 28 + 2;
+  int v10 = one * 31 + 3;
+  int v11 = one * 34 + 4;
+  int v12 = one * 37 + 5;
+  int v13 = one * 40 + 6;
+  int v14 = one * 43 + 0;
+  int v15 = one * 46 + 1;
+  int v16 = one * 49 + 2;
+  int v17 = one * 52 + 3;
+  int v18 = one * 55 + 4;
+  int v19 = one * 58 + 5;
+  int v20 = one * 61 + 6;
+  int v21 = one * 64 + 0;
+  int v22 = one * 67 + 1;
+  int v23 = one * 70 + 2;
+  int v24 = one * 73 + 3;
+  int v25 = one * 76 + 4;
+  int v26 = one * 79 + 5;
+  int v27 = one * 82 + 6;
+  int v28 = one * 85 + 0;
+  int v29 = one * 88 + 1;
+  int v30 = one * 91 + 2;
+  int v31 = one * 94 + 3;
+  int v32 = one * 97 + 4;
+  int v33 = one * 100 + 5;
+  int v34 = one * 103 + 6;
+  int v35 = one * 106 + 0;
+  int v36 = one * 109 + 1;
+  int v37 = one * 112 + 2;
+  int v38 = one * 115 + 3;
+  int v39 = one * 118 + 4;
+  // 所有值都要保留到这里才能用到
+  int sum = 0;
+  sum = sum + v0 * 1;
+  sum = sum + v1 * 2;
+  sum = sum + v2 * 3;
+  sum = sum - v3 * 4;
+  sum = sum + v4 * 5;
+  sum = sum + v5 * 1;
+  sum = sum + v6 * 2;
+  sum = sum - v7 * 3;
+  sum = sum + v8 * 4;
+  sum = sum + v9 * 5;
+  sum = sum + v10 * 1;
+  sum = sum - v11 * 2;
+  sum = sum + v12 * 3;
+  sum = sum + v13 * 4;
+  sum = sum + v14 * 5;
+  sum = sum - v15 * 1;
+  sum = sum + v16 * 2;
+  sum = sum + v17 * 3;
+  sum = sum + v18 * 4;
+  sum = sum - v19 * 5;
+  sum = sum + v20 * 1;
+  sum = sum + v21 * 2;
+  sum = sum + v22 * 3;
+  sum = sum - v23 * 4;
+  sum = sum + v24 * 5;
+  sum = sum + v25 * 1;
+  sum = sum + v26 * 2;
+  sum = sum - v27 * 3;
+  sum = sum + v28 * 4;
+  sum = sum + v29 * 5;
+  sum = sum + v30 * 1;
+  sum = sum - v31 * 2;
+  sum = sum + v32 * 3;
+  sum = sum + v33 * 4;
+  sum = sum + v34 * 5;
+  sum = sum - v35 * 1;
+  sum = sum + v36 * 2;
+  sum = sum + v37 * 3;
+  sum = sum + v38 * 4;
+  sum = sum - v39 * 5;
+  return sum;
+}
@@ -0,0 +1,14 @@
+// return 之后的语句不可达, 它们所在的基本块会被删除
+int main() {
+  int a = 10;
+  {
+    int b = a * 2;
+    {
+      return b + 1;
+      b = b / 0;
+    }
+    a = b;
+  }
+  a = a + 1;
+  return a;
+}
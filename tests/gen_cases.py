@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+"""生成随机的 SysY 测试程序, 同时在生成时求出 main 的返回值.
+
+程序只有 main 一个函数, 包含常量和变量的声明 (可以在内层代码块中重名), 赋值, 表达式语句, 空语句,
+嵌套的代码块和代码块中的 return (之后的语句不可达). 表达式包含所有运算符, 边界附近的常量,
+十六进制和八进制常量, 以及用 && 和 || 保护的除法 (除数可能是 0, 编译器不能把右边提前计算).
+程序中没有除以 0, INT_MIN / -1 和读取未初始化的变量; 加减乘的溢出按 32 位补码回绕.
+
+同样的 seed 总是生成同样的程序.
+
+用法: gen_cases.py [-n count] [-s seed] [--size size] [-o dir]
+  在 dir 中写入 random_NNN.c 和 random_NNN.out, .out 中是 main 的返回值
+"""
+
+import argparse
+import os
+import random
+
+LITERALS = (0, 1, 2, 3, 5, 7, 8, 10, 12, 16, 100, 2047, 2048, 4096, 12345, 65536, 2 ** 31 - 1)
+
+BINARY_OPS = ('+', '-', '*', '/', '%', '<', '>', '<=', '>=', '==', '!=', '&&', '||', '+', '-', '*', '&&', '||')
+
+# 嵌套代码块的最大深度
+MAX_DEPTH = 4
+
+
+# 运行时会出错 (除以 0 或者 INT_MIN / -1) 的表达式, 生成时丢弃重新生成
+class Undefined(Exception):
+    pass
+
+
+def s32(x):
+    x &= 0xffffffff
+    return x - (1 << 32) if x & 0x80000000 else x
+
+
+def div(a, b):
+    if b == 0 or (a == -2 ** 31 and b == -1):
+        raise Undefined()
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def binary(op, a, b):
+    if op == '+':
+        return s32(a + b)
+    if op == '-':
+        return s32(a - b)
+    if op == '*':
+        return s32(a * b)
+    if op == '/':
+        return div(a, b)
+    if op == '%':
+        return a - div(a, b) * b
+    if op == '<':
+        return int(a < b)
+    if op == '>':
+        return int(a > b)
+    if op == '<=':
+        return int(a <= b)
+    if op == '>=':
+        return int(a >= b)
+    if op == '==':
+        return int(a == b)
+    if op == '!=':
+        return int(a != b)
+    if op == '&&':
+        return int(a != 0 and b != 0)
+    return int(a != 0 or b != 0)
+
+
+class Var:
+    def __init__(self, const, value):
+        self.const = const
+        # 还没有初始化的变量是 None
+        self.value = value
+
+
+class Gen:
+    def __init__(self, seed, size):
+        self.rand = random.Random(seed)
+        self.size = size
+        self.scopes = [{}]
+        # 正在声明的名字, 它的初值中不能用到同名的变量
+        self.declaring = None
+        self.lines = []
+
+    def lookup(self, name):
+        for scope in reversed(self.scopes):
+            if name in scope:
+                return scope[name]
+        return None
+
+    # 可以在表达式中使用的名字
+    def names(self, const_only):
+        result = []
+        for scope in self.scopes:
+            for name in scope:
+                if name not in result:
+                    result.append(name)
+        return [n for n in result if n != self.declaring and self.lookup(n).value is not None and
+                (self.lookup(n).const or not const_only)]
+
+    def literal(self):
+        v = self.rand.choice(LITERALS)
+        r = self.rand.random()
+        if r < 0.1 and v > 0:
+            return '0x%x' % v, v
+        if r < 0.2 and v > 0:
+            return '0%o' % v, v
+        return str(v), v
+
+    # 返回表达式的文本和值
+    def expr(self, depth, const_only=False):
+        for _ in range(50):
+            try:
+                return self.try_expr(depth, const_only)
+            except Undefined:
+                pass
+        return self.literal()
+
+    def try_expr(self, depth, const_only):
+        rand = self.rand
+        names = self.names(const_only)
+        if depth <= 0 or rand.random() < 0.2:
+            if names and rand.random() < 0.6:
+                name = rand.choice(names)
+                return name, self.lookup(name).value
+            return self.literal()
+        r = rand.random()
+        if names and r < 0.06:
+            # 短路求值保护的除法
+            name = rand.choice(names)
+            d = self.lookup(name).value
+            text, v = self.try_expr(depth - 1, const_only)
+            if rand.random() < 0.5:
+                return '(%s != 0 && %s / %s)' % (name, text, name), int(d != 0 and div(v, d) != 0)
+            return '(%s == 0 || %s / %s)' % (name, text, name), int(d == 0 or div(v, d) != 0)
+        if r < 0.12:
+            op = rand.choice('+-!')
+            text, v = self.try_expr(depth - 1, const_only)
+            v = v if op == '+' else s32(-v) if op == '-' else int(v == 0)
+            return '%s(%s)' % (op, text), v
+        op = rand.choice(BINARY_OPS)
+        lhs, a = self.try_expr(depth - 1, const_only)
+        rhs, b = self.try_expr(depth - 1, const_only)
+        return '(%s %s %s)' % (lhs, op, rhs), binary(op, a, b)
+
+    def fresh_name(self):
+        return self.rand.choice('abcxyv') + str(self.rand.randint(0, 3))
+
+    def emit(self, depth, line):
+        self.lines.append('  ' * (depth + 1) + line)
+
+    def decl(self, depth, const):
+        defs = []
+        for _ in range(self.rand.randint(1, 3)):
+            name = self.fresh_name()
+            if name in self.scopes[-1]:
+                continue
+            self.declaring = name
+            if const:
+                text, v = self.expr(2, const_only=True)
+            elif self.rand.random() < 0.8:
+                text, v = self.expr(3)
+            else:
+                text, v = None, None
+            self.declaring = None
+            self.scopes[-1][name] = Var(const, v)
+            defs.append(name if text is None else '%s = %s' % (name, text))
+        if defs:
+            self.emit(depth, '%sint %s;' % ('const ' if const else '', ', '.join(defs)))
+
+    # 生成一个代码块中的语句, 执行到 return 时返回它的值, 否则返回 None
+    def block(self, depth):
+        rand = self.rand
+        for _ in range(rand.randint(1, self.size)):
+            r = rand.random()
+            if r < 0.15:
+                self.decl(depth, True)
+            elif r < 0.35:
+                self.decl(depth, False)
+            elif r < 0.6:
+                names = [n for n in self.names(False) if not self.lookup(n).const]
+                names += [n for s in self.scopes for n, v in s.items() if v.value is None and self.lookup(n) is v]
+                if names:
+                    name = rand.choice(names)
+                    text, v = self.expr(3)
+                    self.lookup(name).value = v
+                    self.emit(depth, '%s = %s;' % (name, text))
+            elif r < 0.7:
+                self.emit(depth, '%s;' % self.expr(2)[0])
+            elif r < 0.75:
+                self.emit(depth, ';')
+            elif r < 0.88 and depth < MAX_DEPTH:
+                self.emit(depth, '{')
+                self.scopes.append({})
+                ret = self.block(depth + 1)
+                self.scopes.pop()
+                self.emit(depth, '}')
+                if ret is not None:
+                    return ret
+            elif r < 0.9 and depth > 0:
+                text, v = self.expr(3)
+                self.emit(depth, 'return %s;' % text)
+                # return 之后不可达的语句
+                if rand.random() < 0.5:
+                    self.emit(depth, '%s;' % self.expr(2)[0])
+                return v
+        return None
+
+    def program(self):
+        self.lines.append('int main() {')
+        ret = self.block(0)
+        if ret is None:
+            text, ret = self.expr(4)
+            self.emit(0, 'return %s;' % text)
+        self.lines.append('}')
+        return '\n'.join(self.lines) + '\n', ret
+
+
+def generate(seed, size=12):
+    return Gen(seed, size).program()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='generate random SysY test programs with expected results')
+    parser.add_argument('-n', '--count', type=int, default=100)
+    parser.add_argument('-s', '--seed', type=int, default=1, help='seed of the first program')
+    parser.add_argument('--size', type=int, default=12, help='max statements per block')
+    parser.add_argument('-o', '--output', default='.', help='output directory')
+    args = parser.parse_args()
+    os.makedirs(args.output, exist_ok=True)
+    for i in range(args.count):
+        seed = args.seed + i
+        src, ret = generate(seed, args.size)
+        base = os.path.join(args.output, 'random_%03d' % seed)
+        with open(base + '.c', 'w') as f:
+            f.write(src)
+        with open(base + '.out', 'w') as f:
+            f.write('%d\n' % ret)
+
+
+if __name__ == '__main__':
+    main()
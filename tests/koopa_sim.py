@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""Koopa IR 文本的解释器, 只支持编译器会生成的子集.
+
+支持 alloc, load, store, 二元运算, br, jump 和 ret, 以及带参数的基本块. 所有值都是 i32, 运算结果按 32 位补码回绕.
+读取没有写过的 alloc, 除以 0, jump 的参数个数和目标基本块不同都会报错.
+
+用法: koopa_sim.py input.koopa [-f main]
+"""
+
+import argparse
+import re
+
+# 最多执行的指令数, 防止错误的跳转造成死循环
+MAX_STEPS = 10 ** 7
+
+
+class SimError(Exception):
+    pass
+
+
+def s32(x):
+    x &= 0xffffffff
+    return x - (1 << 32) if x & 0x80000000 else x
+
+
+# 向 0 取整的除法和取模, 和 C 语言相同
+def div(a, b):
+    if b == 0:
+        raise SimError('division by zero')
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+BINARY = {
+    'add': lambda a, b: a + b,
+    'sub': lambda a, b: a - b,
+    'mul': lambda a, b: a * b,
+    'div': div,
+    'mod': lambda a, b: a - div(a, b) * b,
+    'lt': lambda a, b: int(a < b),
+    'gt': lambda a, b: int(a > b),
+    'le': lambda a, b: int(a <= b),
+    'ge': lambda a, b: int(a >= b),
+    'eq': lambda a, b: int(a == b),
+    'ne': lambda a, b: int(a != b),
+    'and': lambda a, b: a & b,
+    'or': lambda a, b: a | b,
+    'xor': lambda a, b: a ^ b,
+    'shl': lambda a, b: a << (b & 31),
+    'shr': lambda a, b: (a & 0xffffffff) >> (b & 31),
+    'sar': lambda a, b: a >> (b & 31),
+}
+
+FUNC_RE = re.compile(r'fun @(\w+)\(\)\s*:\s*i32\s*\{$')
+BLOCK_RE = re.compile(r'(%[\w.]+)(?:\((.*)\))?\s*:$')
+TARGET_RE = re.compile(r'(%[\w.]+)(?:\((.*)\))?$')
+ALLOC_RE = re.compile(r'([%@][\w.]+)\s*=\s*alloc i32$')
+LOAD_RE = re.compile(r'(%[\w.]+)\s*=\s*load ([%@][\w.]+)$')
+STORE_RE = re.compile(r'store (\S+), ([%@][\w.]+)$')
+BINARY_RE = re.compile(r'(%[\w.]+)\s*=\s*(\w+) (\S+), (\S+)$')
+
+
+class Block:
+    def __init__(self, params):
+        self.params = params
+        self.insts = []
+
+
+class Function:
+    def __init__(self):
+        self.blocks = {}
+        self.entry = None
+
+
+def parse(text):
+    funcs = {}
+    func = block = None
+    for line in text.split('\n'):
+        line = line.strip()
+        if not line or line.startswith('//'):
+            continue
+        m = FUNC_RE.match(line)
+        if m:
+            func = funcs[m.group(1)] = Function()
+            continue
+        if line == '}':
+            func = block = None
+            continue
+        m = BLOCK_RE.match(line)
+        if m:
+            params = [p.split(':')[0].strip() for p in m.group(2).split(',')] if m.group(2) else []
+            block = func.blocks[m.group(1)] = Block(params)
+            if func.entry is None:
+                func.entry = m.group(1)
+            continue
+        if block is None:
+            raise SimError('instruction outside a block: ' + line)
+        block.insts.append(line)
+    return funcs
+
+
+# 跳转目标 %bb(arg, ...) 拆成基本块名和参数
+def split_target(text):
+    m = TARGET_RE.match(text.strip())
+    if not m:
+        raise SimError('bad jump target: ' + text)
+    args = [a.strip() for a in m.group(2).split(',')] if m.group(2) else []
+    return m.group(1), args
+
+
+# 按不在括号中的逗号拆分 br 的三个部分
+def split_branch(text):
+    parts = []
+    depth = 0
+    cur = ''
+    for ch in text:
+        if ch == '(':
+            depth += 1
+        elif ch == ')':
+            depth -= 1
+        if ch == ',' and depth == 0:
+            parts.append(cur.strip())
+            cur = ''
+        else:
+            cur += ch
+    parts.append(cur.strip())
+    return parts
+
+
+def run(text, name='main'):
+    funcs = parse(text)
+    if name not in funcs:
+        raise SimError('no function @' + name)
+    func = funcs[name]
+    env = {}
+    mem = {}
+    steps = MAX_STEPS
+
+    def value(v):
+        if re.match(r'-?\d+$', v):
+            return int(v)
+        if v not in env:
+            raise SimError('undefined value ' + v)
+        return env[v]
+
+    label = func.entry
+    while True:
+        target = None
+        for inst in func.blocks[label].insts:
+            steps -= 1
+            if steps < 0:
+                raise SimError('too many steps')
+            m = ALLOC_RE.match(inst)
+            if m:
+                env[m.group(1)] = m.group(1)
+                continue
+            m = LOAD_RE.match(inst)
+            if m:
+                addr = env.get(m.group(2))
+                if addr not in mem:
+                    raise SimError('load before store: ' + inst)
+                env[m.group(1)] = mem[addr]
+                continue
+            m = STORE_RE.match(inst)
+            if m:
+                mem[env[m.group(2)]] = value(m.group(1))
+                continue
+            m = BINARY_RE.match(inst)
+            if m and m.group(2) in BINARY:
+                env[m.group(1)] = s32(BINARY[m.group(2)](value(m.group(3)), value(m.group(4))))
+                continue
+            if inst == 'ret':
+                return None
+            if inst.startswith('ret '):
+                return value(inst[4:].strip())
+            if inst.startswith('jump '):
+                target = split_target(inst[5:])
+                break
+            if inst.startswith('br '):
+                cond, then, other = split_branch(inst[3:])
+                target = split_target(then if value(cond) != 0 else other)
+                break
+            raise SimError('unknown instruction: ' + inst)
+        if target is None:
+            raise SimError('block %s has no terminator' % label)
+        label, args = target
+        if label not in func.blocks:
+            raise SimError('unknown block ' + label)
+        params = func.blocks[label].params
+        if len(params) != len(args):
+            raise SimError('%s expects %d arguments, got %d' % (label, len(params), len(args)))
+        values = [value(a) for a in args]
+        for p, v in zip(params, values):
+            env[p] = v
+
+
+def main():
+    parser = argparse.ArgumentParser(description='interpret Koopa IR generated by the compiler')
+    parser.add_argument('input')
+    parser.add_argument('-f', '--function', default='main')
+    args = parser.parse_args()
+    with open(args.input) as f:
+        print(run(f.read(), args.function))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""RV32IM 汇编的解释器, 只支持编译器会生成的指令.
+
+从函数的标号开始执行到 ret, 返回 a0. 同时检查后端容易出错的地方:
+  - 立即数 (addi 等和 lw/sw 的偏移量) 必须在 12 位有符号数的范围内, 栈帧超过 2047 字节时要先用 li 装入寄存器
+  - 访存地址 4 字节对齐, 并且只读取写过的地址
+  - ret 时 sp 和 callee-saved 寄存器 s0-s11 恢复成进入函数时的值
+
+用法: riscv_sim.py input.s [-f main]
+"""
+
+import argparse
+import re
+
+MAX_STEPS = 10 ** 7
+
+REGS = ('zero', 'ra', 'sp', 'gp', 'tp', 't0', 't1', 't2', 's0', 's1',
+        'a0', 'a1', 'a2', 'a3', 'a4', 'a5', 'a6', 'a7',
+        's2', 's3', 's4', 's5', 's6', 's7', 's8', 's9', 's10', 's11',
+        't3', 't4', 't5', 't6')
+ALIAS = {'x0': 'zero', 'fp': 's0'}
+CALLEE_SAVED = ('sp', 's0', 's1', 's2', 's3', 's4', 's5', 's6', 's7', 's8', 's9', 's10', 's11')
+
+# 进入函数时 sp 的值
+STACK_TOP = 0x7ff00000
+
+MEM_RE = re.compile(r'(-?\w+)\((\w+)\)$')
+
+
+class SimError(Exception):
+    pass
+
+
+def s32(x):
+    x &= 0xffffffff
+    return x - (1 << 32) if x & 0x80000000 else x
+
+
+def u32(x):
+    return x & 0xffffffff
+
+
+# RISC-V 的除法: 除以 0 和 INT_MIN / -1 不会出错, 结果由指令集规定
+def div(a, b):
+    if b == 0:
+        return -1
+    if a == -2 ** 31 and b == -1:
+        return a
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+
+def rem(a, b):
+    if b == 0:
+        return a
+    if a == -2 ** 31 and b == -1:
+        return 0
+    return a - div(a, b) * b
+
+
+def shamt(i):
+    if not 0 <= i < 32:
+        raise SimError('shift amount out of range: %d' % i)
+    return i
+
+
+REG_OPS = {
+    'add': lambda a, b: a + b,
+    'sub': lambda a, b: a - b,
+    'mul': lambda a, b: a * b,
+    'mulh': lambda a, b: (a * b) >> 32,
+    'div': div,
+    'rem': rem,
+    'and': lambda a, b: a & b,
+    'or': lambda a, b: a | b,
+    'xor': lambda a, b: a ^ b,
+    'slt': lambda a, b: int(a < b),
+    'sltu': lambda a, b: int(u32(a) < u32(b)),
+    'sgt': lambda a, b: int(a > b),
+    'sll': lambda a, b: a << (b & 31),
+    'srl': lambda a, b: u32(a) >> (b & 31),
+    'sra': lambda a, b: a >> (b & 31),
+}
+
+IMM_OPS = {
+    'addi': lambda a, i: a + i,
+    'andi': lambda a, i: a & i,
+    'ori': lambda a, i: a | i,
+    'xori': lambda a, i: a ^ i,
+    'slti': lambda a, i: int(a < i),
+    'sltiu': lambda a, i: int(u32(a) < u32(i)),
+    'slli': lambda a, i: a << shamt(i),
+    'srli': lambda a, i: u32(a) >> shamt(i),
+    'srai': lambda a, i: a >> shamt(i),
+}
+
+BRANCH_OPS = {
+    'beq': lambda a, b: a == b,
+    'bne': lambda a, b: a != b,
+    'blt': lambda a, b: a < b,
+    'bge': lambda a, b: a >= b,
+    'bgt': lambda a, b: a > b,
+    'ble': lambda a, b: a <= b,
+}
+
+
+class Stats:
+    def __init__(self):
+        self.insts = 0
+        self.loads = 0
+        self.stores = 0
+
+
+def parse(text):
+    prog = []
+    labels = {}
+    for line in text.split('\n'):
+        line = line.split('#')[0].strip()
+        if not line or line.startswith('.') and not line.endswith(':'):
+            continue
+        if line.endswith(':'):
+            labels[line[:-1]] = len(prog)
+            continue
+        op, _, rest = line.partition(' ')
+        args = [a.strip() for a in rest.split(',')] if rest.strip() else []
+        prog.append((op, args, line))
+    return prog, labels
+
+
+def imm12(text):
+    v = int(text, 0)
+    if not -2048 <= v <= 2047:
+        raise SimError('immediate out of range: %d' % v)
+    return v
+
+
+def run(text, name='main', stats=None):
+    prog, labels = parse(text)
+    if name not in labels:
+        raise SimError('no label ' + name)
+    stats = stats or Stats()
+    regs = {r: 0 for r in REGS}
+    regs['sp'] = STACK_TOP
+    for i, r in enumerate(CALLEE_SAVED[1:]):
+        regs[r] = 0x1234500 + i
+    saved = {r: regs[r] for r in CALLEE_SAVED}
+    mem = {}
+
+    def reg(r):
+        r = ALIAS.get(r, r)
+        if r not in regs:
+            raise SimError('unknown register ' + r)
+        return r
+
+    def get(r):
+        return regs[reg(r)]
+
+    def put(r, v):
+        r = reg(r)
+        if r != 'zero':
+            regs[r] = s32(v)
+
+    def address(text):
+        m = MEM_RE.match(text)
+        if not m:
+            raise SimError('bad memory operand ' + text)
+        addr = u32(get(m.group(2)) + imm12(m.group(1)))
+        if addr % 4 != 0:
+            raise SimError('unaligned access at %#x' % addr)
+        return addr
+
+    def jump(label):
+        if label not in labels:
+            raise SimError('unknown label ' + label)
+        return labels[label]
+
+    pc = labels[name]
+    while True:
+        if stats.insts >= MAX_STEPS:
+            raise SimError('too many steps')
+        if pc >= len(prog):
+            raise SimError('fell off the end of the program')
+        op, a, line = prog[pc]
+        pc += 1
+        stats.insts += 1
+        if op in REG_OPS:
+            put(a[0], REG_OPS[op](get(a[1]), get(a[2])))
+        elif op in IMM_OPS:
+            put(a[0], IMM_OPS[op](get(a[1]), imm12(a[2])))
+        elif op == 'li':
+            put(a[0], int(a[1], 0))
+        elif op == 'mv':
+            put(a[0], get(a[1]))
+        elif op == 'neg':
+            put(a[0], -get(a[1]))
+        elif op == 'not':
+            put(a[0], ~get(a[1]))
+        elif op == 'seqz':
+            put(a[0], int(get(a[1]) == 0))
+        elif op == 'snez':
+            put(a[0], int(get(a[1]) != 0))
+        elif op == 'lw':
+            addr = address(a[1])
+            if addr not in mem:
+                raise SimError('load before store at %#x' % addr)
+            stats.loads += 1
+            put(a[0], mem[addr])
+        elif op == 'sw':
+            stats.stores += 1
+            mem[address(a[1])] = get(a[0])
+        elif op == 'j':
+            pc = jump(a[0])
+        elif op == 'beqz':
+            if get(a[0]) == 0:
+                pc = jump(a[1])
+        elif op == 'bnez':
+            if get(a[0]) != 0:
+                pc = jump(a[1])
+        elif op in BRANCH_OPS:
+            if BRANCH_OPS[op](get(a[0]), get(a[1])):
+                pc = jump(a[2])
+        elif op == 'ret':
+            for r in CALLEE_SAVED:
+                if regs[r] != saved[r]:
+                    raise SimError('%s is not restored before ret' % r)
+            return regs['a0']
+        else:
+            raise SimError('unknown instruction: ' + line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='interpret RISC-V assembly generated by the compiler')
+    parser.add_argument('input')
+    parser.add_argument('-f', '--function', default='main')
+    args = parser.parse_args()
+    with open(args.input) as f:
+        stats = Stats()
+        value = run(f.read(), args.function, stats)
+    print(value)
+    print('insts %d, loads %d, stores %d' % (stats.insts, stats.loads, stats.stores))
+
+
+if __name__ == '__main__':
+    main()
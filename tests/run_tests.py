@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""回归测试: 编译 cases 目录中的每个程序, 解释执行输出, 和期望的返回值比较.
+
+每个测试是 name.c 和 name.out, .out 中是 main 的返回值 (32 位有符号整数). 每个程序按三种方式检查:
+  koopa  compiler -koopa, 用 koopa_sim.py 执行
+  riscv  compiler -riscv, 用 riscv_sim.py 执行, 同时检查立即数范围和 callee-saved 寄存器
+  ir     compiler -ir 输出二进制 IR, 再从 IR 生成 RISC-V, 检查前端和后端分开运行的结果相同
+
+cases 中的 random_NNN 由 gen_cases.py 生成, 其他是手写的程序, 文件开头的注释说明了测的是什么.
+
+用法: run_tests.py -c build/compiler [-j jobs] [-m koopa,riscv,ir] [name ...]
+"""
+
+import argparse
+import concurrent.futures
+import os
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import koopa_sim
+import riscv_sim
+
+TEST_DIR = os.path.dirname(os.path.abspath(__file__))
+MODES = ('koopa', 'riscv', 'ir')
+
+# 一次编译的超时时间 (秒)
+TIMEOUT = 60
+
+
+def compile_file(compiler, mode, src, out):
+    proc = subprocess.run([compiler, mode, src, '-o', out], stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT, timeout=TIMEOUT)
+    if proc.returncode != 0:
+        output = proc.stdout.decode(errors='replace').strip()
+        raise RuntimeError('%s %s failed (exit %d)%s' % (mode, os.path.basename(src), proc.returncode,
+                                                        ': ' + output if output else ''))
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+# 返回 main 的返回值, 编译失败或者执行出错时抛出异常
+def run_mode(compiler, mode, src, work):
+    base = os.path.join(work, os.path.splitext(os.path.basename(src))[0])
+    if mode == 'koopa':
+        compile_file(compiler, '-koopa', src, base + '.koopa')
+        return koopa_sim.run(read(base + '.koopa'))
+    if mode == 'riscv':
+        compile_file(compiler, '-riscv', src, base + '.s')
+        return riscv_sim.run(read(base + '.s'))
+    compile_file(compiler, '-ir', src, base + '.ir')
+    compile_file(compiler, '-riscv', base + '.ir', base + '.ir.s')
+    return riscv_sim.run(read(base + '.ir.s'))
+
+
+# 返回失败信息的列表
+def run_case(compiler, name, modes, work):
+    src = os.path.join(TEST_DIR, 'cases', name + '.c')
+    with open(os.path.join(TEST_DIR, 'cases', name + '.out')) as f:
+        expected = int(f.read().split()[0])
+    failures = []
+    for mode in modes:
+        try:
+            got = run_mode(compiler, mode, src, work)
+        except (RuntimeError, subprocess.TimeoutExpired, koopa_sim.SimError, riscv_sim.SimError) as e:
+            failures.append('%s [%s]: %s' % (name, mode, e))
+            continue
+        if got != expected:
+            failures.append('%s [%s]: expected %d, got %s' % (name, mode, expected, got))
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compile and run the regression tests')
+    parser.add_argument('-c', '--compiler', required=True)
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count())
+    parser.add_argument('-m', '--modes', default=','.join(MODES), help='comma separated subset of ' + ','.join(MODES))
+    parser.add_argument('names', nargs='*', help='tests to run (default: all)')
+    args = parser.parse_args()
+
+    compiler = os.path.abspath(args.compiler)
+    modes = args.modes.split(',')
+    for mode in modes:
+        if mode not in MODES:
+            parser.error('unknown mode: ' + mode)
+    names = args.names or sorted(f[:-2] for f in os.listdir(os.path.join(TEST_DIR, 'cases')) if f.endswith('.c'))
+
+    failures = []
+    with tempfile.TemporaryDirectory() as work:
+        with concurrent.futures.ProcessPoolExecutor(max_workers=args.jobs) as pool:
+            futures = [pool.submit(run_case, compiler, name, modes, work) for name in names]
+            for future in futures:
+                failures += future.result()
+    for failure in failures:
+        print('FAIL ' + failure)
+    print('%d tests, %d modes, %d failures' % (len(names), len(modes), len(failures)))
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == '__main__':
+    main()